@@ -0,0 +1,87 @@
+#ifndef __ARGUMENT_LAYOUT_H__
+#define __ARGUMENT_LAYOUT_H__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Byte layout of a set of trivially copyable event arguments, for the events that copy their raises out of the
+ *        process memory (SharedEventChannel.hpp, EventRecording.hpp). The arguments are packed one after the other,
+ *        each aligned for its type, in a whole number of 64 bit words.
+ *
+ * @tparam Args Arguments of the event, trivially copyable
+ */
+template <class... Args>
+struct ArgumentLayout {
+    static_assert((std::is_trivially_copyable_v<std::decay_t<Args>> && ...),
+                  "Only trivially copyable arguments can be copied out of the process");
+    static_assert(((alignof(std::decay_t<Args>) <= alignof(std::max_align_t)) && ...),
+                  "Over-aligned arguments can't be copied out of the process");
+
+    //* Offset of each argument, aligned for its type, and the total size at the end
+    static constexpr std::array<std::size_t, sizeof...(Args) + 1> Offsets() {
+        std::array<std::size_t, sizeof...(Args) + 1> offsets {};
+        std::size_t sizes[] {sizeof(std::decay_t<Args>)..., 0};
+        std::size_t alignments[] {alignof(std::decay_t<Args>)..., 1};
+        std::size_t offset {0};
+        for (std::size_t i = 0; i < sizeof...(Args); ++i) {
+            offset = (offset + alignments[i] - 1) / alignments[i] * alignments[i];
+            offsets[i] = offset;
+            offset += sizes[i];
+        }
+        offsets[sizeof...(Args)] = offset;
+        return offsets;
+    }
+
+    static constexpr auto Offset {Offsets()};
+    static constexpr std::size_t Words {Offset[sizeof...(Args)] == 0 ? 1 : (Offset[sizeof...(Args)] + 7) / 8};
+
+    //* Identifies the layout, so that a reader of another signature doesn't accept the data
+    static constexpr std::uint64_t Key() {
+        std::uint64_t key {14695981039346656037ull};
+        std::size_t values[] {sizeof...(Args), sizeof(std::decay_t<Args>)..., alignof(std::decay_t<Args>)...};
+        for (std::size_t value : values) {
+            key = (key ^ value) * 1099511628211ull;
+        }
+        return key;
+    }
+
+    //* The packed arguments in process memory, aligned for every argument
+    struct Payload {
+        alignas(std::max_align_t) std::uint64_t words[Words];
+
+        template <std::size_t Index>
+        auto& Get() {
+            using Type = std::decay_t<std::tuple_element_t<Index, std::tuple<Args...>>>;
+            return *std::launder(reinterpret_cast<Type*>(reinterpret_cast<unsigned char*>(words) + Offset[Index]));
+        }
+    };
+
+    static void Write(Payload& payload, const std::decay_t<Args>&... args) {
+        WriteEach(payload, std::index_sequence_for<Args...>{}, args...);
+    }
+
+    //* Calls func with the arguments stored in the payload, as an Event raised with them
+    template <class Func>
+    static void Apply(Payload& payload, Func&& func) {
+        ApplyEach(payload, func, std::index_sequence_for<Args...>{});
+    }
+
+private:
+    template <std::size_t... Index>
+    static void WriteEach(Payload& payload, std::index_sequence<Index...>, const std::decay_t<Args>&... args) {
+        ((std::memcpy(&payload.template Get<Index>(), &args, sizeof(args))), ...);
+    }
+
+    template <class Func, std::size_t... Index>
+    static void ApplyEach(Payload& payload, Func& func, std::index_sequence<Index...>) {
+        func(static_cast<Args&&>(payload.template Get<Index>())...);
+    }
+};
+#endif // __ARGUMENT_LAYOUT_H__
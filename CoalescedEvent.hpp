@@ -0,0 +1,194 @@
+#ifndef __COALESCED_EVENT_H__
+#define __COALESCED_EVENT_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Event.hpp"
+
+template <class Signature, class Policy = EventPolicy<>>
+class CoalescedEvent;
+
+/**
+ * @brief Event for values that change many times between two reads, e.g. a position or health: Coalesce overwrites
+ *        a pending copy of the arguments instead of calling the subscribers, and Flush raises the event once with
+ *        the last arguments. Coalesce(key, args...) keeps a pending copy per key instead, e.g. per entity, and Flush
+ *        raises the event once for each key as well. Pending copies are raised in the order they were first
+ *        coalesced. Subscribers are the same as in Event, and Invoke still calls them right away.
+ *
+ *        The slots for the keys are allocated by the constructor, Coalesce and Flush don't allocate.
+ *        Like Event, it is not thread safe.
+ *
+ * @tparam R Return type
+ * @tparam Args Function arguments
+ * @tparam Policy See EventPolicy
+ */
+template <class R, class... Args, class Policy>
+class CoalescedEvent<R(Args...), Policy> : public Event<R(Args...), Policy> {
+public:
+    //* What a slot holds: a copy of the last coalesced arguments, references included
+    using Arguments = std::tuple<std::decay_t<Args>...>;
+
+private:
+    struct Slot {
+        std::uint64_t key;
+        bool used;
+        std::optional<Arguments> values;
+    };
+
+    //* Slots of one flush, keyed ones in an open addressing table followed by the slot without a key. There are two,
+    //* so that what handlers coalesce while flushing waits for the next Flush.
+    struct Table {
+        std::unique_ptr<Slot[]> slots;
+        std::unique_ptr<std::size_t[]> order; // Pending slots in the order they were first coalesced
+        std::size_t pending {0};
+    };
+
+    Table tables[2];
+    std::size_t current {0};
+    std::size_t mask;
+    std::size_t coalesced {0};
+
+    static std::size_t RoundCapacity(std::size_t capacity) {
+        std::size_t rounded {2};
+        while (rounded < capacity) {
+            rounded *= 2;
+        }
+        return rounded;
+    }
+
+    std::size_t Unkeyed() const {
+        return mask + 1;
+    }
+
+    template <class... T>
+    void Store(Table& table, std::size_t index, T&&... args) {
+        Slot& slot {table.slots[index]};
+        if (slot.values) {
+            *slot.values = Arguments(std::forward<T>(args)...);
+            ++coalesced;
+        } else {
+            slot.values.emplace(std::forward<T>(args)...);
+            table.order[table.pending++] = index;
+        }
+    }
+
+    //* The event owns the values, so the last subscriber can take them
+    template <std::size_t... Index>
+    void Raise(Arguments& values, std::index_sequence<Index...>) {
+        this->InvokeMoveLast(static_cast<Args&&>(std::get<Index>(values))...);
+    }
+
+public:
+    /**
+     * @brief Allocates the slots of the keys
+     *
+     * @param keys Different keys that can be pending at the same time, rounded up to a power of two
+     */
+    explicit CoalescedEvent(std::size_t keys = 64) : mask{RoundCapacity(keys * 2) - 1} {
+        for (Table& table : tables) {
+            table.slots.reset(new Slot[mask + 2]);
+            table.order.reset(new std::size_t[mask + 2]);
+            for (std::size_t i = 0; i <= mask + 1; ++i) {
+                table.slots[i].used = false;
+            }
+        }
+    }
+
+    //* Slots are indexed by position, it can't be copied or moved
+    CoalescedEvent(const CoalescedEvent&) = delete;
+    CoalescedEvent& operator=(const CoalescedEvent&) = delete;
+
+    /**
+     * @brief Keeps the arguments for the next Flush, replacing the ones coalesced since the last Flush
+     *
+     * @param args
+     */
+    template <class... T>
+    void Coalesce(T&&... args) {
+        Store(tables[current], Unkeyed(), std::forward<T>(args)...);
+    }
+
+    /**
+     * @brief Keeps the arguments for the next Flush, replacing the ones coalesced with the same key since the last
+     *        Flush
+     *
+     * @param key Source of the raise, e.g. EventKey{entityId}
+     * @param args
+     * @return false if every slot already holds another key, the arguments were not kept
+     */
+    template <class... T>
+    bool Coalesce(EventKey key, T&&... args) {
+        Table& table {tables[current]};
+        std::size_t index {static_cast<std::size_t>(key.value * 0x9e3779b97f4a7c15ull >> 32) & mask};
+        for (std::size_t probe = 0; probe <= mask; ++probe, index = (index + 1) & mask) {
+            Slot& slot {table.slots[index]};
+            if (!slot.used) {
+                // Keeping the table at most half full keeps the probes short
+                std::size_t keys {table.pending - (table.slots[Unkeyed()].values ? 1 : 0)};
+                if (keys == Capacity()) {
+                    return false;
+                }
+                slot.used = true;
+                slot.key = key.value;
+            } else if (slot.key != key.value) {
+                continue;
+            }
+            Store(table, index, std::forward<T>(args)...);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Raises the event once for each pending slot through InvokeMoveLast, the last subscriber takes the
+     *        arguments. Arguments coalesced by the handlers are kept for the next Flush, and a Flush called by a
+     *        handler while flushing does nothing.
+     *
+     * @return Number of times the event was raised
+     */
+    std::size_t Flush() {
+        // The other table only has pending slots while they are being flushed
+        if (tables[current ^ 1].pending != 0) {
+            return 0;
+        }
+        Table& flushing {tables[current]};
+        current ^= 1;
+        std::size_t raised {flushing.pending};
+        for (std::size_t i = 0; i < raised; ++i) {
+            Slot& slot {flushing.slots[flushing.order[i]]};
+            Raise(*slot.values, std::index_sequence_for<Args...>{});
+            slot.values.reset();
+            slot.used = false;
+        }
+        flushing.pending = 0;
+        return raised;
+    }
+
+    /**
+     * @brief Number of raises the next Flush makes, one per pending key and one for the arguments without a key
+     */
+    std::size_t Pending() const {
+        return tables[current].pending;
+    }
+
+    /**
+     * @brief Number of different keys that can be pending at the same time
+     */
+    std::size_t Capacity() const {
+        return (mask + 1) / 2;
+    }
+
+    /**
+     * @brief Arguments replaced before they were flushed, since the event was created
+     */
+    std::size_t Coalesced() const {
+        return coalesced;
+    }
+};
+#endif // __COALESCED_EVENT_H__
@@ -0,0 +1,221 @@
+#ifndef __COMPACT_EVENT_H__
+#define __COMPACT_EVENT_H__
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "Event.hpp"
+
+template <class Signature, class Policy = EventPolicy<>>
+class CompactEvent;
+
+/**
+ * @brief Event that is one pointer wide until something subscribes to it. The subscriber storage (a regular Event)
+ *        is allocated by the first Subscribe and kept until the CompactEvent is destroyed, so handles stay valid.
+ *        Meant for objects that embed many events that rarely get subscribers, e.g. one per entity.
+ *
+ *        The interface is the same as Event. Raising an event without subscribers only checks the pointer.
+ *
+ * @tparam R Return type
+ * @tparam Args Function arguments
+ * @tparam Policy See EventPolicy
+ */
+template <class R, class... Args, class Policy>
+class CompactEvent<R(Args...), Policy> {
+private:
+    using Storage = Event<R(Args...), Policy>;
+    using Delegate = typename Storage::DelegateType;
+
+    std::unique_ptr<Storage> event;
+
+    Storage& Allocate() {
+        if (!event) {
+            event = std::make_unique<Storage>();
+        }
+        return *event;
+    }
+
+public:
+    CompactEvent() = default;
+
+    CompactEvent(const CompactEvent& other)
+        : event{other.event ? std::make_unique<Storage>(*other.event) : nullptr} {}
+
+    CompactEvent(CompactEvent&&) = default;
+
+    CompactEvent& operator=(const CompactEvent& other) {
+        if (this != &other) {
+            CompactEvent copy {other};
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    CompactEvent& operator=(CompactEvent&&) = default;
+
+    //* See Event for the documentation of every overload.
+
+    template <class Invoker, class Type>
+    Connection Subscribe(const std::string& id, R(Type::*func)(Args... args), Invoker* invoker, int priority = 0) {
+        return Allocate().Subscribe(id, func, invoker, priority);
+    }
+
+    template <class Invoker, class Type>
+    Connection Subscribe(const std::string& id, R (Type::*func)(Args... args) const, const Invoker* invoker, int priority = 0) {
+        return Allocate().Subscribe(id, func, invoker, priority);
+    }
+
+    template <auto Method, class Invoker>
+    Connection Subscribe(const std::string& id, Invoker* invoker, int priority = 0) {
+        return Allocate().template Subscribe<Method>(id, invoker, priority);
+    }
+
+    Connection Subscribe(const std::string& id, Delegate func, int priority = 0) {
+        return Allocate().Subscribe(id, std::move(func), priority);
+    }
+
+    template <class Invoker, class Type>
+    Connection Subscribe(R(Type::*func)(Args... args), Invoker* invoker, int priority = 0) {
+        return Allocate().Subscribe(func, invoker, priority);
+    }
+
+    template <class Invoker, class Type>
+    Connection Subscribe(R (Type::*func)(Args... args) const, const Invoker* invoker, int priority = 0) {
+        return Allocate().Subscribe(func, invoker, priority);
+    }
+
+    template <auto Method, class Invoker>
+    Connection Subscribe(Invoker* invoker, int priority = 0) {
+        return Allocate().template Subscribe<Method>(invoker, priority);
+    }
+
+    Connection Subscribe(Delegate func, int priority = 0) {
+        return Allocate().Subscribe(std::move(func), priority);
+    }
+
+    template <class Invoker, class Type>
+    Connection Subscribe(EventKey key, R(Type::*func)(Args... args), Invoker* invoker, int priority = 0) {
+        return Allocate().Subscribe(key, func, invoker, priority);
+    }
+
+    template <class Invoker, class Type>
+    Connection Subscribe(EventKey key, R (Type::*func)(Args... args) const, const Invoker* invoker, int priority = 0) {
+        return Allocate().Subscribe(key, func, invoker, priority);
+    }
+
+    template <auto Method, class Invoker>
+    Connection Subscribe(EventKey key, Invoker* invoker, int priority = 0) {
+        return Allocate().template Subscribe<Method>(key, invoker, priority);
+    }
+
+    Connection Subscribe(EventKey key, Delegate func, int priority = 0) {
+        return Allocate().Subscribe(key, std::move(func), priority);
+    }
+
+    template <class Invoker>
+    void Unsubscribe(const std::string& id, Invoker* invoker) {
+        if (event) {
+            event->Unsubscribe(id, invoker);
+        }
+    }
+
+    template <class Invoker>
+    void Unsubscribe(const std::string& id, const Invoker* invoker) {
+        if (event) {
+            event->Unsubscribe(id, invoker);
+        }
+    }
+
+    void Unsubscribe(const std::string& id) {
+        if (event) {
+            event->Unsubscribe(id);
+        }
+    }
+
+    void Unsubscribe(SubscriptionHandle handle) {
+        if (event) {
+            event->Unsubscribe(handle);
+        }
+    }
+
+    bool IsSubscribed(SubscriptionHandle handle) const {
+        return event && event->IsSubscribed(handle);
+    }
+
+    template <class Invoker>
+    void RemoveListener(Invoker* invoker) {
+        if (event) {
+            event->RemoveListener(invoker);
+        }
+    }
+
+    template <class Invoker>
+    void RemoveListener(const Invoker* invoker) {
+        if (event) {
+            event->RemoveListener(invoker);
+        }
+    }
+
+    void RemoveFreeFunctions() {
+        if (event) {
+            event->RemoveFreeFunctions();
+        }
+    }
+
+    /**
+     * @brief Checks if the subscriber storage was allocated, i.e. if anything ever subscribed to this event
+     */
+    bool IsAllocated() const {
+        return event != nullptr;
+    }
+
+    void Invoke(InvokeArg<Args>... args) {
+        if (event) {
+            event->Invoke(std::forward<decltype(args)>(args)...);
+        }
+    }
+
+    void InvokeMoveLast(Args... args) {
+        if (event) {
+            event->InvokeMoveLast(std::forward<decltype(args)>(args)...);
+        }
+    }
+
+    void Invoke(EventKey key, InvokeArg<Args>... args) {
+        if (event) {
+            event->Invoke(key, std::forward<decltype(args)>(args)...);
+        }
+    }
+
+    template <class Combiner>
+    auto Invoke(Combiner&& combiner, InvokeArg<Args>... args) {
+        if (event) {
+            return event->Invoke(std::forward<Combiner>(combiner), std::forward<decltype(args)>(args)...);
+        }
+        return combiner.Result();
+    }
+
+    template <class Combiner>
+    auto Invoke(InvokeArg<Args>... args) {
+        return Invoke(Combiner{}, std::forward<decltype(args)>(args)...);
+    }
+
+    void InvokeParallel(EventExecutor& executor, const Args&... args) {
+        if (event) {
+            event->InvokeParallel(executor, args...);
+        }
+    }
+
+    template <class Pool = ThreadPool>
+    void InvokeParallel(const Args&... args) {
+        if (event) {
+            event->template InvokeParallel<Pool>(args...);
+        }
+    }
+
+    void operator()(InvokeArg<Args>... args) {
+        Invoke(std::forward<decltype(args)>(args)...);
+    }
+};
+#endif // __COMPACT_EVENT_H__
@@ -0,0 +1,322 @@
+#ifndef __CONCURRENT_EVENT_H__
+#define __CONCURRENT_EVENT_H__
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Event.hpp"
+
+/**
+ * @brief Epoch based reclamation shared by every ConcurrentEvent.
+ *        Readers announce the epoch in which they started reading; memory retired by a writer is freed
+ *        once no reader that could still see it is left. Readers never wait for writers, and writers never
+ *        wait for readers unless they ask to with Synchronize().
+ */
+class EpochDomain {
+private:
+    static constexpr std::uint64_t Idle {std::numeric_limits<std::uint64_t>::max()};
+
+    struct Record {
+        std::atomic<std::uint64_t> epoch {Idle};
+        std::atomic<bool> inUse {true};
+        Record* next {nullptr};
+        unsigned depth {0}; // Only touched by the owning thread, to support nested reads
+    };
+
+    struct Retired {
+        void* ptr;
+        void (*deleter)(void*);
+        std::uint64_t epoch; // Safe to free once every reader announced at least this epoch
+    };
+
+    std::atomic<std::uint64_t> globalEpoch {0};
+    std::atomic<Record*> records {nullptr};
+    std::mutex retiredMutex;
+    std::vector<Retired> retired;
+
+    //* Gives the calling thread a record, reusing the one of a thread that exited if there is one
+    Record* Acquire() {
+        for (Record* record {records.load()}; record; record = record->next) {
+            bool expected {false};
+            if (!record->inUse.load(std::memory_order_relaxed) && record->inUse.compare_exchange_strong(expected, true)) {
+                return record;
+            }
+        }
+
+        Record* record {new Record};
+        record->next = records.load();
+        while (!records.compare_exchange_weak(record->next, record)) {
+        }
+        return record;
+    }
+
+    Record& ThreadRecord() {
+        //* Releases the record of a thread when it exits
+        struct Owner {
+            Record* record {nullptr};
+
+            ~Owner() {
+                if (record) {
+                    record->epoch.store(Idle);
+                    record->inUse.store(false);
+                }
+            }
+        };
+
+        thread_local Owner owner;
+        if (!owner.record) {
+            owner.record = Acquire();
+        }
+        return *owner.record;
+    }
+
+    std::uint64_t OldestReader() const {
+        std::uint64_t oldest {Idle};
+        for (Record* record {records.load()}; record; record = record->next) {
+            std::uint64_t epoch {record->epoch.load()};
+            if (epoch < oldest) {
+                oldest = epoch;
+            }
+        }
+        return oldest;
+    }
+
+    EpochDomain() = default;
+
+public:
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    ~EpochDomain() {
+        for (auto& item : retired) {
+            item.deleter(item.ptr);
+        }
+        for (Record* record {records.load()}; record;) {
+            Record* next {record->next};
+            delete record;
+            record = next;
+        }
+    }
+
+    static EpochDomain& Instance() {
+        static EpochDomain domain;
+        return domain;
+    }
+
+    /**
+     * @brief Marks the calling thread as reading shared data until it is destroyed. Wait free once the thread
+     *        has a record (its first read allocates one). Guards can be nested.
+     */
+    class ReadGuard {
+    private:
+        Record& record;
+
+    public:
+        ReadGuard() : record{Instance().ThreadRecord()} {
+            if (record.depth++ == 0) {
+                record.epoch.store(Instance().globalEpoch.load());
+            }
+        }
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        ~ReadGuard() {
+            if (--record.depth == 0) {
+                record.epoch.store(Idle);
+            }
+        }
+    };
+
+    /**
+     * @brief Frees ptr with deleter once no reader can be using it. The pointer must already be unreachable for new readers.
+     */
+    void Retire(void* ptr, void (*deleter)(void*)) {
+        std::uint64_t epoch {globalEpoch.fetch_add(1) + 1};
+        std::lock_guard<std::mutex> lock {retiredMutex};
+        retired.push_back({ptr, deleter, epoch});
+        Collect();
+    }
+
+    /**
+     * @brief Blocks until every reader that started before this call has finished.
+     *        Must not be called while reading (e.g. from an event handler), it would wait for itself.
+     */
+    void Synchronize() {
+        std::uint64_t epoch {globalEpoch.fetch_add(1) + 1};
+        while (OldestReader() < epoch) {
+            std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> lock {retiredMutex};
+        Collect();
+    }
+
+private:
+    //* Called with retiredMutex locked
+    void Collect() {
+        std::uint64_t oldest {OldestReader()};
+        std::size_t kept {0};
+        for (auto& item : retired) {
+            if (item.epoch <= oldest) {
+                item.deleter(item.ptr);
+            } else {
+                retired[kept++] = item;
+            }
+        }
+        retired.resize(kept);
+    }
+};
+
+/**
+ * @brief Threading policy locking a recursive mutex around every function of the event, Invoke included, so the
+ *        handlers of an event run one at a time. Handlers can still use the event they are called from.
+ */
+struct MutexThreaded {
+    template <class Delegate>
+    class State {
+    private:
+        mutable std::recursive_mutex mutex;
+
+    protected:
+        static constexpr bool LockFreeInvoke {false};
+
+        State() = default;
+
+        //* A copy of the event has its own mutex
+        State(const State&) {}
+
+        State& operator=(const State&) {
+            return *this;
+        }
+
+        void Lock() const {
+            mutex.lock();
+        }
+
+        template <class Delegates>
+        void Unlock(const Delegates&) const {
+            mutex.unlock();
+        }
+
+        void Modified() const {}
+
+        template <class Delegates>
+        void Publish(const Delegates&) const {}
+    };
+};
+
+/**
+ * @brief Threading policy where Invoke(args...) and Invoke(combiner, args...) never block: they call an immutable
+ *        snapshot of the subscribers, which is replaced (copy on write) when a change to the subscribers unlocks the
+ *        event. Replaced snapshots are freed through EpochDomain once no Invoke uses them. Every other function,
+ *        Invoke(key, args...) and InvokeParallel included, locks a recursive mutex like MutexThreaded.
+ */
+struct LockFreeThreaded {
+    template <class Delegate>
+    class State {
+    private:
+        struct Snapshot {
+            std::vector<Delegate> delegates;
+        };
+
+        mutable std::recursive_mutex mutex;
+        mutable unsigned depth {0};      // Nested locks of the thread holding the mutex
+        mutable bool modified {false};   // The delegates changed since the last snapshot
+        mutable std::atomic<Snapshot*> snapshot {new Snapshot};
+
+        static void DeleteSnapshot(void* ptr) {
+            delete static_cast<Snapshot*>(ptr);
+        }
+
+    protected:
+        static constexpr bool LockFreeInvoke {true};
+
+        State() = default;
+
+        //* A copy of the event has its own mutex and snapshot, published once its subscribers are copied
+        State(const State&) {}
+
+        State& operator=(const State&) {
+            return *this;
+        }
+
+        //* No thread may be raising the event while it is destroyed
+        ~State() {
+            delete snapshot.load();
+        }
+
+        void Lock() const {
+            mutex.lock();
+            ++depth;
+        }
+
+        template <class Delegates>
+        void Unlock(const Delegates& delegates) const {
+            if (--depth == 0 && modified) {
+                Publish(delegates);
+            }
+            mutex.unlock();
+        }
+
+        void Modified() const {
+            modified = true;
+        }
+
+        template <class Delegates>
+        void Publish(const Delegates& delegates) const {
+            Snapshot* next {new Snapshot};
+            next->delegates.reserve(delegates.size());
+            for (auto& func : delegates) {
+                if (func) {
+                    next->delegates.push_back(func);
+                }
+            }
+            modified = false;
+            Snapshot* previous {snapshot.exchange(next)};
+            EpochDomain::Instance().Retire(previous, &DeleteSnapshot);
+        }
+
+        //* Calls read with the delegates of the current snapshot, which stays alive until read returns
+        template <class Reader>
+        void Read(Reader&& read) const {
+            EpochDomain::ReadGuard guard;
+            read(static_cast<const Snapshot*>(snapshot.load())->delegates);
+        }
+    };
+};
+
+template <class>
+class ConcurrentEvent;
+
+/**
+ * @brief Thread safe Event, an Event with the LockFreeThreaded policy. Invoke never blocks: it calls an immutable
+ *        snapshot of the subscribers, which Subscribe/Unsubscribe/RemoveListener replace (copy on write) while holding
+ *        a lock between writers. Replaced snapshots are freed through EpochDomain once no Invoke uses them.
+ *        
+ *        A handler can still be called by an Invoke that started before Unsubscribe returned. Call Synchronize()
+ *        after unsubscribing and before destroying the subscriber if other threads may be raising the event.
+ * 
+ * @tparam R Return type
+ * @tparam Args Function arguments
+ */
+template <class R, class... Args>
+class ConcurrentEvent<R(Args...)> : public Event<R(Args...), EventPolicy<DefaultLogging, LockFreeThreaded>> {
+public:
+    ConcurrentEvent() = default;
+
+    ConcurrentEvent(const ConcurrentEvent&) = delete;
+    ConcurrentEvent& operator=(const ConcurrentEvent&) = delete;
+
+    /**
+     * @brief Blocks until every Invoke that started before this call has returned, so functions unsubscribed
+     *        before it won't be called anymore. Must not be called from a handler.
+     */
+    void Synchronize() {
+        EpochDomain::Instance().Synchronize();
+    }
+};
+#endif // __CONCURRENT_EVENT_H__
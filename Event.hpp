@@ -3,12 +3,33 @@
 
 // #define EVENT_DEBUG_INFO
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 #ifdef EVENT_DEBUG_INFO
-#include <iostream>
-#include <string_view>
+#include "EventLogging.hpp"
+#endif
+#ifdef EVENT_TRACE
+#include "EventTrace.hpp"
+#endif
+// co_await on events, when compiled as C++20 with coroutine support
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#define EVENT_COROUTINES
+#endif
 
 // Credits to this function: https://stackoverflow.com/a/56766138/576911
 // from thread https://stackoverflow.com/questions/81870/is-it-possible-to-print-a-variables-type-in-standard-c
@@ -38,7 +59,6 @@ const char* type_name() {
     return typeid(TR).name();
 #endif // C++17
 }
-#endif
 
 //* Utility functions to create std::functions without std::placeholder_1 , ...
 template<class Type, class R, class... Args>
@@ -48,32 +68,2100 @@ std::function<R(Args...)> EasyBind(R(Type::*func)(Args... args), Type* invoker)
     };
 }
 
-template<class Type, class R, class... Args>
-std::function<R(Args...)> EasyBind(R(Type::*func)(Args... args) const, const Type* invoker) {
-    return [=](auto&&... args) {
-        return (invoker->*func)(std::forward<decltype(args)>(args)...);
-    };
-}
+template<class Type, class R, class... Args>
+std::function<R(Args...)> EasyBind(R(Type::*func)(Args... args) const, const Type* invoker) {
+    return [=](auto&&... args) {
+        return (invoker->*func)(std::forward<decltype(args)>(args)...);
+    };
+}
+
+//* Gives the class of a member function pointer, const qualified when the member function is const
+template <class>
+struct MemberFunctionClass;
+
+template <class Type, class R, class... Args>
+struct MemberFunctionClass<R(Type::*)(Args...)> {
+    using type = Type;
+};
+
+template <class Type, class R, class... Args>
+struct MemberFunctionClass<R(Type::*)(Args...) const> {
+    using type = const Type;
+};
+
+template <class Type, class R, class... Args>
+struct MemberFunctionClass<R(Type::*)(Args...) noexcept> {
+    using type = Type;
+};
+
+template <class Type, class R, class... Args>
+struct MemberFunctionClass<R(Type::*)(Args...) const noexcept> {
+    using type = const Type;
+};
+
+template <class Func>
+using MemberFunctionClassT = typename MemberFunctionClass<Func>::type;
+
+/**
+ * @brief Non owning view of contiguous elements, used to hand several values to a handler at once (std::span is C++20)
+ */
+template <class T>
+class Span {
+private:
+    T* first {nullptr};
+    std::size_t count {0};
+
+public:
+    Span() = default;
+
+    Span(T* data, std::size_t size) : first{data}, count{size} {}
+
+    T* begin() const { return first; }
+    T* end() const { return first + count; }
+    T* data() const { return first; }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    T& operator[](std::size_t index) const { return first[index]; }
+};
+
+/**
+ * @brief How Invoke receives an argument of the event signature: arguments taken by value are read through a const
+ *        reference to the caller's object, so raising an event doesn't copy them. Scalars, references and types
+ *        that can't be copied are taken as they are.
+ */
+template <class T>
+using InvokeArg = std::conditional_t<std::is_reference_v<T> || std::is_scalar_v<T> || !std::is_copy_constructible_v<T>,
+                                     T, const T&>;
+
+/**
+ * @brief Subscriptions of one member function that Event calls through a single delegate: one function and an
+ *        array of instances, in subscription order. See Event::Subscribe.
+ *        Removed instances are left as nullptr, skipped by the call, until the group is compacted.
+ *        The arrays are allocated from the memory resource of the event, see GroupStorage.
+ */
+class DelegateGroup {
+public:
+    static constexpr std::uint32_t RemovedSlot {0xFFFFFFFF};
+
+    std::pmr::vector<std::uint32_t> slots; // Event slot of each instance, RemovedSlot for removed ones
+    std::size_t removed {0};          // Instances left as nullptr
+    bool dense {false};               // Compacted after every removal, except while the event is raised
+    //* Calls the instances in [first, last) with the arguments of Event::InvokeParallel, so a group can be split
+    //* across chunks
+    void (*callRange)(const DelegateGroup& group, std::size_t first, std::size_t last, const void* arguments) {nullptr};
+
+    virtual ~DelegateGroup() = default;
+
+    void Remove(std::size_t member) {
+        slots[member] = RemovedSlot;
+        ++removed;
+        Clear(member);
+    }
+
+    //* Drops the removed instances, keeping the order of the others
+    virtual void Compact() = 0;
+
+protected:
+    explicit DelegateGroup(std::pmr::memory_resource* resource) : slots{resource} {}
+    DelegateGroup(const DelegateGroup& other, std::pmr::memory_resource* resource)
+        : slots{other.slots, resource}, removed{other.removed}, dense{other.dense}, callRange{other.callRange} {}
+    DelegateGroup(const DelegateGroup&) = delete;
+    DelegateGroup& operator=(const DelegateGroup&) = delete;
+
+    virtual void Clear(std::size_t member) = 0;
+};
+
+template <class Type>
+class InstanceGroup : public DelegateGroup {
+public:
+    std::pmr::vector<Type*> instances;
+
+    explicit InstanceGroup(std::pmr::memory_resource* resource) : DelegateGroup{resource}, instances{resource} {}
+    InstanceGroup(const InstanceGroup& other, std::pmr::memory_resource* resource)
+        : DelegateGroup{other, resource}, instances{other.instances, resource} {}
+
+    std::uint32_t Append(Type* instance, std::uint32_t slot) {
+        instances.push_back(instance);
+        slots.push_back(slot);
+        return static_cast<std::uint32_t>(slots.size() - 1);
+    }
+
+    void Compact() override {
+        std::size_t kept {0};
+        for (std::size_t i = 0; i < instances.size(); ++i) {
+            if (instances[i]) {
+                instances[kept] = instances[i];
+                slots[kept] = slots[i];
+                ++kept;
+            }
+        }
+        instances.resize(kept);
+        slots.resize(kept);
+        removed = 0;
+    }
+
+protected:
+    void Clear(std::size_t member) override {
+        instances[member] = nullptr;
+    }
+};
+
+//* Base of GroupStorage, so a Delegate can find the group it holds without knowing the allocator
+struct GroupOwner {
+    DelegateGroup* group {nullptr};
+    //* Moves the group to memory of another allocator of the same type, see GroupStorage::Rebind
+    void (*rebind)(GroupOwner& owner, const void* allocator) {nullptr};
+};
+
+/**
+ * @brief The callable a Delegate stores for a group: the group, allocated with the allocator of its event, and the
+ *        allocator. It fits in the inline buffer of the Delegate, so all the memory of a group comes from the event,
+ *        e.g. from the memory resource of a PmrEvent.
+ *
+ * @tparam Group A DelegateGroup taking the memory resource of its arrays as first constructor argument
+ * @tparam Allocator Allocator of the event
+ */
+template <class Group, class Allocator>
+class GroupStorage : public GroupOwner {
+private:
+    using GroupAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Group>;
+    using Traits = std::allocator_traits<GroupAllocator>;
+
+    GroupAllocator allocator;
+
+    static Group* Create(GroupAllocator& allocator, const Group& other) {
+        Group* created {Traits::allocate(allocator, 1)};
+        ::new (static_cast<void*>(created)) Group(other, Resource(allocator));
+        return created;
+    }
+
+    void Destroy() {
+        Group* owned {&Get()};
+        owned->~Group();
+        Traits::deallocate(allocator, owned, 1);
+    }
+
+    //* Copies the group into memory of the allocator and frees the old one, when the allocators differ. Used by an
+    //* event moved into one with another memory resource.
+    static void Rebind(GroupOwner& owner, const void* target) {
+        GroupStorage& self {static_cast<GroupStorage&>(owner)};
+        GroupAllocator allocator {*static_cast<const Allocator*>(target)};
+        if (allocator == self.allocator) {
+            return;
+        }
+        Group* created {Create(allocator, self.Get())};
+        self.Destroy();
+        self.group = created;
+        // Polymorphic allocators can't be assigned
+        self.allocator.~GroupAllocator();
+        ::new (static_cast<void*>(&self.allocator)) GroupAllocator(allocator);
+    }
+
+    //* The arrays of the group use the resource of a polymorphic allocator, else the global heap like std::allocator
+    static std::pmr::memory_resource* Resource(const GroupAllocator& allocator) {
+        if constexpr (std::is_same_v<GroupAllocator, std::pmr::polymorphic_allocator<Group>>) {
+            return allocator.resource();
+        } else {
+            return std::pmr::new_delete_resource();
+        }
+    }
+
+public:
+    template <class... Params>
+    explicit GroupStorage(const Allocator& allocator, Params&&... params) : GroupOwner{nullptr, &Rebind}, allocator{allocator} {
+        Group* created {Traits::allocate(this->allocator, 1)};
+        ::new (static_cast<void*>(created)) Group(Resource(this->allocator), std::forward<Params>(params)...);
+        group = created;
+    }
+
+    //* Like the containers of a copied event, the copy gets the allocator of select_on_container_copy_construction
+    GroupStorage(const GroupStorage& other)
+        : GroupOwner{nullptr, &Rebind}, allocator{Traits::select_on_container_copy_construction(other.allocator)} {
+        group = Create(allocator, other.Get());
+    }
+
+    GroupStorage(GroupStorage&& other) noexcept
+        : GroupOwner{std::exchange(other.group, nullptr), &Rebind}, allocator{other.allocator} {}
+
+    GroupStorage& operator=(const GroupStorage&) = delete;
+    GroupStorage& operator=(GroupStorage&&) = delete;
+
+    ~GroupStorage() {
+        if (group) {
+            Destroy();
+        }
+    }
+
+    Group& Get() const {
+        return *static_cast<Group*>(group);
+    }
+
+    template <class... Params>
+    void operator()(Params&&... params) const {
+        Get()(std::forward<Params>(params)...);
+    }
+};
+
+template <class, std::size_t = 4 * sizeof(void*)>
+class Delegate;
+
+/**
+ * @brief Fixed-size function wrapper used as the storage of Event.
+ *        Member functions (function pointer + instance), free functions and small lambdas are stored
+ *        inline without heap allocations. Callables that don't fit in the buffer (e.g. a big std::function)
+ *        are still accepted and kept on the heap.
+ * 
+ *        The stored callable gets references to one set of arguments. Event calls every subscriber but the one
+ *        taking ownership with const views of them, see Invoke and InvokeMoveLast.
+ *
+ * @tparam R Return type
+ * @tparam Args Function arguments
+ * @tparam Size Bytes of the inline buffer, see InlineStorage
+ */
+template <class R, class... Args, std::size_t Size>
+class Delegate<R(Args...), Size> {
+public:
+    static constexpr std::size_t BufferSize {Size};
+
+private:
+    template <class, class>
+    friend class Event;
+    template <class, class>
+    friend class QueuedEvent;
+
+    enum class Operation { Copy, Move, Destroy, Group };
+
+    //* Scalars and lvalue references are passed as they are, shared by every call
+    template <class T>
+    static constexpr bool PassedAsIs {std::is_lvalue_reference_v<T> || std::is_scalar_v<T>};
+
+    template <class T>
+    using Value = std::remove_cv_t<std::remove_reference_t<T>>;
+
+    //* How the stub receives each argument: a reference to the object held by the caller, const for arguments
+    //* taken by value since the caller may only have a const reference (see InvokeArg)
+    template <class T>
+    using ArgRef = std::conditional_t<PassedAsIs<T>, T, std::conditional_t<std::is_rvalue_reference_v<T>, Value<T>&, const Value<T>&>>;
+
+    //* The argument as seen by a subscriber that shares it with others
+    template <class T>
+    using SharedArg = std::conditional_t<PassedAsIs<T>, T, const Value<T>&>;
+
+    //* The stub receives take = true when the callable may take ownership of the arguments
+    using Stub = R (*)(void* callable, bool take, ArgRef<Args>... args);
+    using Manager = void (*)(Operation op, void* dest, void* src);
+
+    //* Only called with take = true on arguments the caller owns, which are never const objects
+    template <class T>
+    static decltype(auto) Owned(ArgRef<T> arg) {
+        if constexpr (PassedAsIs<T>) {
+            return static_cast<ArgRef<T>>(arg);
+        } else {
+            return std::move(const_cast<Value<T>&>(arg));
+        }
+    }
+
+    //* A copy for each subscriber that needs its own, i.e. one that takes an rvalue reference. Arguments that can't be
+    //* copied are moved, so the first such subscriber takes them.
+    template <class T>
+    static decltype(auto) Copied(ArgRef<T> arg) {
+        if constexpr (PassedAsIs<T>) {
+            return static_cast<ArgRef<T>>(arg);
+        } else if constexpr (std::is_copy_constructible_v<Value<T>>) {
+            return Value<T>(std::as_const(arg));
+        } else {
+            return Owned<T>(arg);
+        }
+    }
+
+    template <class F>
+    static R Call(F& func, bool take, ArgRef<Args>... args) {
+        if (take) {
+            return func(Owned<Args>(args)...);
+        }
+        if constexpr (std::is_invocable_v<F&, SharedArg<Args>...>) {
+            return func(static_cast<SharedArg<Args>>(args)...);
+        } else {
+            return func(Copied<Args>(args)...);
+        }
+    }
+
+    //* Parameters are forwarded to the member function as they come, so a const view isn't turned into a copy
+    //* before the member function needs one
+    template <class Type, class Func>
+    struct MemberBinding {
+        Func func;
+        Type* invoker;
+
+        template <class... Params>
+        auto operator()(Params&&... params) const -> decltype((invoker->*func)(std::forward<Params>(params)...)) {
+            return (invoker->*func)(std::forward<Params>(params)...);
+        }
+    };
+
+    //* The member function is part of the type, so the call is direct and can be inlined into the stub
+    template <auto Method, class Type>
+    struct MethodBinding {
+        Type* invoker;
+
+        template <class... Params>
+        auto operator()(Params&&... params) const -> decltype((invoker->*Method)(std::forward<Params>(params)...)) {
+            return (invoker->*Method)(std::forward<Params>(params)...);
+        }
+    };
+
+    template <class F>
+    static constexpr bool StoredInline {sizeof(F) <= BufferSize && alignof(F) <= alignof(std::max_align_t) &&
+                                        std::is_nothrow_move_constructible_v<F>};
+
+    //* Zeroed, so copying the whole buffer never reads bytes the stored callable left uninitialized
+    alignas(std::max_align_t) mutable unsigned char buffer[BufferSize] {};
+    Stub stub {nullptr};
+    //* Copies, moves and destroys the stored callable. Null when it is trivially copyable, in which case the buffer is just copied.
+    Manager manager {nullptr};
+
+    template <class F>
+    static R InlineStub(void* callable, bool take, ArgRef<Args>... args) {
+        return Call(*static_cast<F*>(callable), take, args...);
+    }
+
+    template <class F>
+    static R HeapStub(void* callable, bool take, ArgRef<Args>... args) {
+        return Call(**static_cast<F**>(callable), take, args...);
+    }
+
+    template <class F>
+    static void InlineManager(Operation op, void* dest, void* src) {
+        switch (op) {
+        case Operation::Copy:
+            ::new (dest) F(*static_cast<const F*>(src));
+            break;
+        case Operation::Move:
+            ::new (dest) F(std::move(*static_cast<F*>(src)));
+            static_cast<F*>(src)->~F();
+            break;
+        case Operation::Destroy:
+            static_cast<F*>(dest)->~F();
+            break;
+        case Operation::Group:
+            if constexpr (std::is_base_of_v<GroupOwner, F>) {
+                *static_cast<GroupOwner**>(dest) = static_cast<F*>(src);
+            }
+            break;
+        }
+    }
+
+    template <class F>
+    static void HeapManager(Operation op, void* dest, void* src) {
+        switch (op) {
+        case Operation::Copy:
+            *static_cast<F**>(dest) = new F(**static_cast<F* const*>(src));
+            break;
+        case Operation::Move:
+            *static_cast<F**>(dest) = *static_cast<F**>(src);
+            break;
+        case Operation::Destroy:
+            delete *static_cast<F**>(dest);
+            break;
+        case Operation::Group:
+            if constexpr (std::is_base_of_v<GroupOwner, F>) {
+                *static_cast<GroupOwner**>(dest) = *static_cast<F**>(src);
+            }
+            break;
+        }
+    }
+
+    template <class F>
+    void Store(F&& func) {
+        using Callable = std::decay_t<F>;
+        if constexpr (StoredInline<Callable>) {
+            ::new (static_cast<void*>(buffer)) Callable(std::forward<F>(func));
+            stub = &InlineStub<Callable>;
+            if constexpr (!(std::is_trivially_copyable_v<Callable> && std::is_trivially_destructible_v<Callable>)) {
+                manager = &InlineManager<Callable>;
+            }
+        } else {
+            *reinterpret_cast<Callable**>(buffer) = new Callable(std::forward<F>(func));
+            stub = &HeapStub<Callable>;
+            manager = &HeapManager<Callable>;
+        }
+    }
+
+    void Reset() {
+        if (manager) {
+            manager(Operation::Destroy, buffer, nullptr);
+        }
+        stub = nullptr;
+        manager = nullptr;
+    }
+
+    //* Stops the delegate from being called but keeps the stored callable alive, since it may be running.
+    //* It is destroyed when the delegate is reset or destroyed.
+    void Disable() {
+        stub = nullptr;
+    }
+
+    void MoveFrom(Delegate& other) noexcept {
+        stub = other.stub;
+        manager = other.manager;
+        if (manager) {
+            manager(Operation::Move, buffer, other.buffer);
+        } else {
+            std::memcpy(buffer, other.buffer, BufferSize);
+        }
+        other.stub = nullptr;
+        other.manager = nullptr;
+    }
+
+    //* The stored callable if it is an F, else nullptr
+    template <class F>
+    F* Target() const {
+        if constexpr (StoredInline<F>) {
+            return stub == &InlineStub<F> ? reinterpret_cast<F*>(buffer) : nullptr;
+        } else {
+            return stub == &HeapStub<F> ? *reinterpret_cast<F**>(buffer) : nullptr;
+        }
+    }
+
+    //* The stored callable if it is a group of subscriptions, see GroupStorage
+    GroupOwner* Owner() const {
+        GroupOwner* owner {nullptr};
+        if (manager) {
+            manager(Operation::Group, &owner, buffer);
+        }
+        return owner;
+    }
+
+    //* The group of subscriptions called by the delegate, see DelegateGroup
+    DelegateGroup* Group() const {
+        GroupOwner* owner {Owner()};
+        return owner ? owner->group : nullptr;
+    }
+
+    //* Calls with the arguments shared by every subscriber of an Invoke
+    R CallShared(ArgRef<Args>... args) const {
+        return stub(buffer, false, args...);
+    }
+
+    //* Calls letting the callable take the arguments, which must be owned by the caller
+    R CallOwning(ArgRef<Args>... args) const {
+        return stub(buffer, true, args...);
+    }
+
+public:
+    Delegate() = default;
+
+    Delegate(std::nullptr_t) {}
+
+    /**
+     * @brief Stores a free function, lambda, capture lambda or std::function
+     */
+    template <class F, class = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Delegate> &&
+                                                std::is_invocable_r_v<R, std::decay_t<F>&, Args...>>>
+    Delegate(F&& func) {
+        Store(std::forward<F>(func));
+    }
+
+    /**
+     * @brief Binds a member function to an instance
+     */
+    template <class Type>
+    Delegate(R(Type::*func)(Args... args), Type* invoker) {
+        Store(MemberBinding<Type, decltype(func)>{func, invoker});
+    }
+
+    /**
+     * @brief Binds a const member function to a const instance
+     */
+    template <class Type>
+    Delegate(R(Type::*func)(Args... args) const, const Type* invoker) {
+        Store(MemberBinding<const Type, decltype(func)>{func, invoker});
+    }
+
+    /**
+     * @brief Binds a member function known at compile time to an instance. Only the instance pointer is stored
+     *        and the call to the member function can be inlined.
+     * 
+     * @tparam Method The member function, e.g. &Type::Function
+     * @param invoker The instance owning the member function
+     */
+    template <auto Method, class Type>
+    static Delegate Bind(Type* invoker) {
+        static_assert(std::is_invocable_r_v<R, decltype(Method), Type*, Args...>,
+                      "Method can't be called with the arguments of this Delegate");
+        Delegate deleg;
+        deleg.Store(MethodBinding<Method, Type>{invoker});
+        return deleg;
+    }
+
+    Delegate(const Delegate& other) : stub{other.stub}, manager{other.manager} {
+        if (manager) {
+            manager(Operation::Copy, buffer, other.buffer);
+        } else {
+            std::memcpy(buffer, other.buffer, BufferSize);
+        }
+    }
+
+    Delegate(Delegate&& other) noexcept {
+        MoveFrom(other);
+    }
+
+    Delegate& operator=(const Delegate& other) {
+        if (this != &other) {
+            Delegate copy {other};
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    Delegate& operator=(Delegate&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    ~Delegate() {
+        Reset();
+    }
+
+    explicit operator bool() const {
+        return stub != nullptr;
+    }
+
+    /**
+     * @brief Calls the stored function, which can take the arguments
+     */
+    R operator()(Args... args) const {
+        return stub(buffer, true, args...);
+    }
+};
+
+/**
+ * @brief Identifies a subscription to an Event. Unsubscribing with a handle doesn't need to hash an id.
+ *        Handles of removed subscriptions are detected through the generation, so using them is a no-op.
+ */
+struct SubscriptionHandle {
+    static constexpr std::uint32_t InvalidIndex {0xFFFFFFFF};
+
+    std::uint32_t index {InvalidIndex};
+    std::uint32_t generation {0};
+
+    explicit operator bool() const {
+        return index != InvalidIndex;
+    }
+
+    friend bool operator==(SubscriptionHandle lhs, SubscriptionHandle rhs) {
+        return lhs.index == rhs.index && lhs.generation == rhs.generation;
+    }
+
+    friend bool operator!=(SubscriptionHandle lhs, SubscriptionHandle rhs) {
+        return !(lhs == rhs);
+    }
+};
+
+/**
+ * @brief Key of a keyed subscription, usually the id of the object the subscriber cares about.
+ *        Invoke(key, args...) only calls the functions subscribed with the same key.
+ */
+struct EventKey {
+    std::uint64_t value {0};
+
+    constexpr explicit EventKey(std::uint64_t value) : value{value} {}
+};
+
+class Connectable;
+
+//* Shared by an event and its connections. The event keeps it pointing to itself when moved, and the connections
+//* see it expire when the event is destroyed.
+struct ConnectionAnchor {
+    Connectable* event;
+    void (*disconnect)(Connectable* event, SubscriptionHandle handle);
+    bool (*isConnected)(const Connectable* event, SubscriptionHandle handle);
+};
+
+//* Base of the events that hand out connections, owning their anchor. It's only allocated by the first Subscribe.
+class Connectable {
+private:
+    template <class, class>
+    friend class Event;
+
+    std::shared_ptr<ConnectionAnchor> anchor;
+
+protected:
+    Connectable() = default;
+
+    //* A copy is another event, the connections keep referring to the original
+    Connectable(const Connectable&) {}
+
+    Connectable(Connectable&& other) noexcept : anchor{std::move(other.anchor)} {
+        if (anchor) {
+            anchor->event = this;
+        }
+    }
+
+    Connectable& operator=(const Connectable&) {
+        return *this;
+    }
+
+    Connectable& operator=(Connectable&& other) noexcept {
+        if (this != &other) {
+            anchor = std::move(other.anchor);
+            if (anchor) {
+                anchor->event = this;
+            }
+        }
+        return *this;
+    }
+
+    ~Connectable() = default;
+};
+
+/**
+ * @brief Subscription returned by Event::Subscribe that can remove itself from its event, in constant time and
+ *        without knowing the event type. It is also a SubscriptionHandle. Destroying a Connection doesn't unsubscribe,
+ *        use ScopedConnection or ConnectionGroup for that.
+ *        Events are only checked when disconnecting, so raising an event costs the same with or without connections.
+ */
+class Connection : public SubscriptionHandle {
+private:
+    std::weak_ptr<ConnectionAnchor> anchor;
+
+public:
+    Connection() = default;
+
+    Connection(SubscriptionHandle handle, std::weak_ptr<ConnectionAnchor> anchor)
+        : SubscriptionHandle{handle}, anchor{std::move(anchor)} {}
+
+    /**
+     * @brief Unsubscribes the function. Does nothing if it was already removed or the event was destroyed.
+     */
+    void Disconnect() {
+        if (auto target {anchor.lock()}) {
+            target->disconnect(target->event, *this);
+        }
+        anchor.reset();
+    }
+
+    /**
+     * @brief Checks if the function is still subscribed to its event
+     */
+    bool IsConnected() const {
+        auto target {anchor.lock()};
+        return target && target->isConnected(target->event, *this);
+    }
+};
+
+/**
+ * @brief Owns a Connection and disconnects it when destroyed, e.g. as a member of the subscriber:
+ *        ScopedConnection onDamage {event.Subscribe(&Player::TakeDamage, this)};
+ */
+class ScopedConnection {
+private:
+    Connection connection;
+
+public:
+    ScopedConnection() = default;
+
+    ScopedConnection(Connection connection) : connection{std::move(connection)} {}
+
+    ScopedConnection(const ScopedConnection&) = delete;
+    ScopedConnection& operator=(const ScopedConnection&) = delete;
+
+    ScopedConnection(ScopedConnection&&) = default;
+
+    ScopedConnection& operator=(ScopedConnection&& other) noexcept {
+        if (this != &other) {
+            connection.Disconnect();
+            connection = std::move(other.connection);
+        }
+        return *this;
+    }
+
+    ~ScopedConnection() {
+        connection.Disconnect();
+    }
+
+    void Disconnect() {
+        connection.Disconnect();
+    }
+
+    bool IsConnected() const {
+        return connection.IsConnected();
+    }
+
+    /**
+     * @brief Stops owning the connection without disconnecting it
+     */
+    Connection Release() {
+        Connection released {std::move(connection)};
+        return released;
+    }
+};
+
+/**
+ * @brief Connections of one subscriber to any number of events, disconnected together by DisconnectAll or when the
+ *        group is destroyed, e.g. connections += event.Subscribe(&Player::TakeDamage, this);
+ */
+class ConnectionGroup {
+private:
+    std::vector<Connection> connections;
+
+public:
+    ConnectionGroup() = default;
+
+    ConnectionGroup(const ConnectionGroup&) = delete;
+    ConnectionGroup& operator=(const ConnectionGroup&) = delete;
+
+    ConnectionGroup(ConnectionGroup&&) = default;
+
+    ConnectionGroup& operator=(ConnectionGroup&& other) noexcept {
+        if (this != &other) {
+            DisconnectAll();
+            connections = std::move(other.connections);
+        }
+        return *this;
+    }
+
+    ~ConnectionGroup() {
+        DisconnectAll();
+    }
+
+    void Add(Connection connection) {
+        connections.push_back(std::move(connection));
+    }
+
+    ConnectionGroup& operator+=(Connection connection) {
+        Add(std::move(connection));
+        return *this;
+    }
+
+    void DisconnectAll() {
+        for (auto& connection : connections) {
+            connection.Disconnect();
+        }
+        connections.clear();
+    }
+
+    std::size_t Size() const {
+        return connections.size();
+    }
+};
+
+//* Combiners aggregate the values returned by the subscribers, see Event::Invoke(combiner, args...).
+//* A combiner is called with each returned value and returns false to stop calling the remaining subscribers.
+//* Result() gives the aggregated value. Any type following this interface can be used as combiner.
+
+/**
+ * @brief Result of the first subscriber, which is the only one called. Empty if there are no subscribers.
+ */
+template <class T>
+class CombineFirst {
+private:
+    std::optional<T> value;
+
+public:
+    bool operator()(T result) {
+        value.emplace(std::move(result));
+        return false;
+    }
+
+    std::optional<T> Result() { return std::move(value); }
+};
+
+/**
+ * @brief Result of the last subscriber. Empty if there are no subscribers.
+ */
+template <class T>
+class CombineLast {
+private:
+    std::optional<T> value;
+
+public:
+    bool operator()(T result) {
+        value.emplace(std::move(result));
+        return true;
+    }
+
+    std::optional<T> Result() { return std::move(value); }
+};
+
+/**
+ * @brief Sum of the results of all subscribers
+ */
+template <class T>
+class CombineSum {
+private:
+    T total;
+
+public:
+    explicit CombineSum(T initial = T{}) : total{std::move(initial)} {}
+
+    bool operator()(T result) {
+        total += std::move(result);
+        return true;
+    }
+
+    T Result() { return std::move(total); }
+};
+
+/**
+ * @brief True if every subscriber returned true. Stops at the first false. True if there are no subscribers.
+ */
+class CombineAllOf {
+private:
+    bool value {true};
+
+public:
+    bool operator()(bool result) {
+        value = result;
+        return result;
+    }
+
+    bool Result() const { return value; }
+};
+
+/**
+ * @brief True if any subscriber returned true. Stops at the first true. False if there are no subscribers.
+ */
+class CombineAnyOf {
+private:
+    bool value {false};
+
+public:
+    bool operator()(bool result) {
+        value = result;
+        return !result;
+    }
+
+    bool Result() const { return value; }
+};
+
+/**
+ * @brief Writes the results into a buffer owned by the caller. Every subscriber is still called when the buffer
+ *        is full, but the results that don't fit are dropped.
+ */
+template <class T>
+class CombineInto {
+private:
+    Span<T> buffer;
+    std::size_t count {0};
+    std::size_t dropped {0};
+
+public:
+    explicit CombineInto(Span<T> buffer) : buffer{buffer} {}
+
+    bool operator()(T result) {
+        if (count < buffer.size()) {
+            buffer[count++] = std::move(result);
+        } else {
+            ++dropped;
+        }
+        return true;
+    }
+
+    /**
+     * @brief The part of the buffer that was written
+     */
+    Span<T> Result() const { return {buffer.data(), count}; }
+
+    /**
+     * @brief Number of results that didn't fit in the buffer
+     */
+    std::size_t Dropped() const { return dropped; }
+};
+
+/**
+ * @brief Runs the work of Event::InvokeParallel. Implement it to run events on your own job system,
+ *        or use ThreadPool (ThreadPool.hpp).
+ */
+class EventExecutor {
+public:
+    virtual ~EventExecutor() = default;
+
+    /**
+     * @brief Number of threads that can run tasks at the same time, used to split the work. 0 is treated as 1.
+     */
+    virtual std::size_t Concurrency() const = 0;
+
+    /**
+     * @brief Calls task(i) for every i in [0, count), possibly in parallel, and returns when all of them are done
+     */
+    virtual void ParallelFor(std::size_t count, const Delegate<void(std::size_t)>& task) = 0;
+};
+
+#ifdef EVENT_COROUTINES
+/**
+ * @brief Resumes coroutines waiting on an event somewhere else than inside Invoke, e.g. on the thread of a job system
+ *        or at the start of the next frame. See Event::Next.
+ */
+class EventScheduler {
+public:
+    virtual ~EventScheduler() = default;
+
+    /**
+     * @brief Resumes the coroutine later, possibly on another thread. It must be resumed exactly once.
+     */
+    virtual void Schedule(std::coroutine_handle<> coroutine) = 0;
+};
+
+//* What co_await returns for an event with the arguments Args: a tuple with a copy of each argument, a copy of the
+//* only argument, or nothing
+template <class... Args>
+struct EventAwaitResult {
+    using type = std::tuple<std::decay_t<Args>...>;
+};
+
+template <class Arg>
+struct EventAwaitResult<Arg> {
+    using type = std::decay_t<Arg>;
+};
+
+template <>
+struct EventAwaitResult<> {
+    using type = void;
+};
+#endif
+
+//* Policies of Event, chosen per event with EventPolicy, e.g. Event<void(int), EventPolicy<ConsoleLogging>>, so events
+//* with different needs can live in the same program. A policy only adds the code its event needs: with the defaults,
+//* everything the policies could add compiles to nothing.
+
+/**
+ * @brief Logging policy that records nothing, the default unless EVENT_DEBUG_INFO or EVENT_TRACE is defined.
+ *        Also the interface of the logging policies: Log(message) calls message with the stream to write to, and
+ *        InvokeScope/HandlerScope live while the event is raised and while each handler runs.
+ *        ConsoleLogging (EventLogging.hpp) prints the messages and TraceLogging (EventTrace.hpp) records them in the
+ *        trace buffers.
+ */
+struct NoLogging {
+    static constexpr bool TimesHandlers {false}; // Whether Event has to look up the slot of every handler it calls
+
+    template <class Message>
+    static void Log(Message&&) {}
+
+    static void Subscribed(const void*, std::uint32_t, std::uint32_t, const std::string&) {}
+
+    static void Unsubscribed(const void*, std::uint32_t, std::uint32_t) {}
+
+    struct InvokeScope {
+        explicit InvokeScope(const void*) {}
+    };
+
+    struct HandlerScope {
+        HandlerScope(const void*, std::uint32_t, std::uint32_t) {}
+    };
+};
+
+#if defined(EVENT_DEBUG_INFO)
+using DefaultLogging = ConsoleLogging;
+#elif defined(EVENT_TRACE)
+using DefaultLogging = TraceLogging;
+#else
+using DefaultLogging = NoLogging;
+#endif
+
+/**
+ * @brief Threading policy of events used by one thread at a time, the default. MutexThreaded and LockFreeThreaded
+ *        are in ConcurrentEvent.hpp.
+ *        An event derives from the State of its threading policy. Lock and Unlock are called around every function
+ *        that uses the subscribers, Modified when the delegates change and Publish after the event is copied or moved.
+ *        With LockFreeInvoke, Invoke calls the delegates that State::Read gives it without locking.
+ */
+struct SingleThreaded {
+    template <class Delegate>
+    class State {
+    protected:
+        static constexpr bool LockFreeInvoke {false};
+
+        void Lock() const {}
+
+        template <class Delegates>
+        void Unlock(const Delegates&) const {}
+
+        void Modified() const {}
+
+        template <class Delegates>
+        void Publish(const Delegates&) const {}
+    };
+};
+
+/**
+ * @brief Storage policy, the bytes a Delegate stores inline. Callables that don't fit are kept on the heap.
+ */
+template <std::size_t InlineSize = 4 * sizeof(void*)>
+struct InlineStorage {
+    template <class Signature>
+    using Delegate = ::Delegate<Signature, InlineSize>;
+};
+
+//* Ordering policies. PriorityOrder calls subscribers with higher priority first and equal priorities in subscription
+//* order. InsertionOrder ignores the priorities, so nothing has to be kept sorted.
+
+struct PriorityOrder {
+    static constexpr bool Prioritized {true};
+};
+
+struct InsertionOrder {
+    static constexpr bool Prioritized {false};
+};
+
+//* Allocation policies. StdAllocation, the default, always allocates from the global heap. PmrAllocation allocates from
+//* the memory resource given to the event (the default resource otherwise), at the cost of a pointer in every container.
+
+struct PmrAllocation {
+    template <class T>
+    using Allocator = std::pmr::polymorphic_allocator<T>;
+};
+
+struct StdAllocation {
+    template <class T>
+    using Allocator = std::allocator<T>;
+};
+
+/**
+ * @brief The policies of an event, e.g. EventPolicy<NoLogging, SingleThreaded, InlineStorage<>, InsertionOrder>
+ */
+template <class LoggingPolicy = DefaultLogging, class ThreadingPolicy = SingleThreaded, class StoragePolicy = InlineStorage<>,
+          class OrderingPolicy = PriorityOrder, class AllocationPolicy = StdAllocation>
+struct EventPolicy {
+    using Logging = LoggingPolicy;
+    using Threading = ThreadingPolicy;
+    using Storage = StoragePolicy;
+    using Ordering = OrderingPolicy;
+    using Allocation = AllocationPolicy;
+};
+
+template <class Signature, class Policy>
+using EventDelegate = typename Policy::Storage::template Delegate<Signature>;
+
+class ThreadPool;
+
+template <class Signature, class Policy = EventPolicy<>>
+class Event;
+
+//* Event whose subscriber storage comes from the memory resource given to its constructor, see PmrAllocation
+template <class Signature>
+using PmrEvent = Event<Signature, EventPolicy<DefaultLogging, SingleThreaded, InlineStorage<>, PriorityOrder, PmrAllocation>>;
+
+template <class Signature, class Policy = EventPolicy<>>
+class QueuedEvent;
+
+/**
+ * @brief Event that can call all of its subscribers
+ * 
+ * @tparam R Return type
+ * @tparam Args Function arguments
+ * @tparam Policy Logging, threading, storage, ordering and allocation of the event, see EventPolicy
+ */
+template <class R, class... Args, class Policy>
+class Event<R(Args...), Policy> : private Connectable, private Policy::Threading::template State<EventDelegate<R(Args...), Policy>> {
+public:
+    using DelegateType = EventDelegate<R(Args...), Policy>;
+
+private:
+    friend class QueuedEvent<R(Args...), Policy>;
+
+    using Delegate = DelegateType;
+    using Logging = typename Policy::Logging;
+    using Ordering = typename Policy::Ordering;
+    using Sync = typename Policy::Threading::template State<Delegate>;
+
+    template <class T>
+    using Allocator = typename Policy::Allocation::template Allocator<T>;
+    template <class T>
+    using Vector = std::vector<T, Allocator<T>>;
+    template <class Key, class T>
+    using HashMap = std::unordered_map<Key, T, std::hash<Key>, std::equal_to<Key>, Allocator<std::pair<const Key, T>>>;
+    using String = std::basic_string<char, std::char_traits<char>, Allocator<char>>;
+    using FuncMap = HashMap<String, std::uint32_t>;
+
+    //* All the subscriber storage comes from the allocator of the allocation policy, e.g. the memory resource given to
+    //* the constructor. The structs below take the allocator of the container holding them, so their own containers
+    //* use the same resource.
+
+    //* All subscriptions of one invoker (nullptr for free functions and lambdas)
+    struct Listener {
+        using allocator_type = Allocator<char>;
+
+        Vector<std::uint32_t> slots;
+        FuncMap named; // Subscriptions that were given an id
+
+        explicit Listener(const allocator_type& allocator = {}) : slots{allocator}, named{allocator} {}
+        Listener(const Listener& other, const allocator_type& allocator) : slots{other.slots, allocator}, named{other.named, allocator} {}
+        Listener(Listener&& other, const allocator_type& allocator)
+            : slots{std::move(other.slots), allocator}, named{std::move(other.named), allocator} {}
+    };
+
+    //* Stable identity of a subscription. Handles refer to a slot, and the slot to its delegate, which can move.
+    struct Slot {
+        using allocator_type = Allocator<char>;
+
+        std::uint32_t position;         // Position of the delegate in delegates, PendingBit + position in pendingDelegates
+                                        // while it waits for the event to finish raising, or the next free slot when unused
+        std::uint32_t generation {0};   // Incremented when the slot is released, invalidating its handles
+        std::uint32_t listenerPosition; // Position in owner->slots
+        std::uint32_t member {SubscriptionHandle::InvalidIndex}; // Position in the group at position, see Join
+        Listener* owner;                // Pointers to unordered_map elements are stable across rehashes
+        const void* invoker;
+        bool isConst;
+        bool isKeyed {false};
+        std::uint64_t key {0};
+        String id;
+
+        explicit Slot(const allocator_type& allocator = {}) : id{allocator} {}
+        // Assigning a string keeps its own allocator
+        Slot(const Slot& other, const allocator_type& allocator) : id{allocator} {
+            *this = other;
+        }
+        Slot(Slot&& other, const allocator_type& allocator) : id{allocator} {
+            *this = std::move(other);
+        }
+        Slot(const Slot&) = default;
+        Slot(Slot&&) = default;
+        Slot& operator=(const Slot&) = default;
+        Slot& operator=(Slot&&) = default;
+    };
+
+    //* Every subscribed function lives in this array, so Invoke is a linear walk over contiguous memory.
+    //* It is sorted by priority, highest first, and is only reordered by Subscribe/Unsubscribe, never while raising the event.
+    Vector<Delegate> delegates;
+    Vector<std::uint32_t> delegateSlots; // Slot of each delegate, GroupSlot for a group of subscriptions
+    Vector<int> priorities;              // Priority of each delegate, empty with InsertionOrder
+    std::size_t erasedDelegates {0};     // Empty delegates left by removals, see EraseDelegate
+    Vector<Slot> slots;
+    std::uint32_t freeSlots {SubscriptionHandle::InvalidIndex};
+    //* Index from invoker and id to a slot. Only used to find subscribers, never when raising the event.
+    HashMap<void*, Listener> listeners;
+    HashMap<const void*, Listener> constListeners;
+
+    //* Keyed subscriptions of each key, sorted like delegates. Entries are added when their delegate is inserted in
+    //* delegates, and an entry whose slot generation changed belongs to a removed subscription.
+    struct KeyedEntry {
+        std::uint32_t slot;
+        std::uint32_t generation;
+        int priority;
+    };
+
+    //* Adds the subscription in slot, whose delegate is deleg, to the delegate at position if both call the same
+    //* member function. See Join.
+    using Joiner = bool (*)(Event& event, std::size_t position, std::uint32_t slot, Delegate& deleg);
+
+    //* Changes made by handlers while the event is raised can't touch the delegate array being iterated. The
+    //* bookkeeping above is updated right away, but new delegates wait in Extra and removed delegates are only
+    //* disabled, until the outermost Invoke returns. The buffers keep their capacity, so this doesn't allocate once
+    //* warmed up.
+    struct PendingDelegate {
+        std::uint32_t slot;
+        int priority;
+        Delegate deleg;
+        Joiner join;
+    };
+
+    static constexpr std::uint32_t PendingBit {0x80000000};
+    static constexpr std::uint32_t GroupSlot {0xFFFFFFFE};
+
+    //* State that most events never use, allocated by the first keyed subscription or change made while raising, so
+    //* it costs an empty event a pointer instead of its containers
+    struct Extra {
+        using allocator_type = Allocator<char>;
+
+        HashMap<std::uint64_t, Vector<KeyedEntry>> keyed;
+        Vector<PendingDelegate> pendingDelegates; // Subscribed while raising, not called until the next Invoke
+        Vector<std::uint32_t> disabledDelegates;  // Positions removed while raising, destroyed afterwards
+        Vector<std::uint32_t> changedGroups;      // Positions of groups that lost instances while raising
+        Vector<std::uint64_t> staleKeys;          // Keys that lost a subscription while raising
+
+        explicit Extra(const allocator_type& allocator)
+            : keyed{allocator}, pendingDelegates{allocator}, disabledDelegates{allocator}, changedGroups{allocator},
+              staleKeys{allocator} {}
+        Extra(const Extra& other, const allocator_type& allocator)
+            : keyed{other.keyed, allocator}, pendingDelegates{other.pendingDelegates, allocator},
+              disabledDelegates{other.disabledDelegates, allocator}, changedGroups{other.changedGroups, allocator},
+              staleKeys{other.staleKeys, allocator} {}
+        Extra(Extra&& other, const allocator_type& allocator)
+            : keyed{std::move(other.keyed), allocator}, pendingDelegates{std::move(other.pendingDelegates), allocator},
+              disabledDelegates{std::move(other.disabledDelegates), allocator},
+              changedGroups{std::move(other.changedGroups), allocator}, staleKeys{std::move(other.staleKeys), allocator} {}
+    };
+    using ExtraAllocator = typename std::allocator_traits<Allocator<char>>::template rebind_alloc<Extra>;
+
+    Extra* extra {nullptr};     // Allocated from the allocator of slots
+    unsigned dispatchDepth {0}; // Number of nested Invoke calls running
+
+    //* Coroutine suspended in co_await event, see Awaiter. Waiters live in the coroutine frames and are linked into
+    //* a list in the event, so waiting allocates nothing. The list is part of the event in C++17 too, always empty.
+    struct Waiter {
+        Waiter* previous {nullptr};
+        Waiter* next {nullptr};
+        Event* event {nullptr};       // The event while linked
+        std::uint32_t generation {0}; // waitGeneration when it started waiting
+        void (*wake)(Waiter& waiter, const std::remove_reference_t<Args>&... args) {nullptr};
+    };
+
+    Waiter* firstWaiter {nullptr};
+    Waiter* lastWaiter {nullptr};
+    std::uint32_t waitGeneration {0}; // Incremented by every Invoke that resumes waiters
+
+    //* Marks the event as being raised for its lifetime and applies the pending changes when the outermost one ends
+    class DispatchScope {
+    private:
+        Event& event;
+
+    public:
+        explicit DispatchScope(Event& event) : event{event} {
+            ++event.dispatchDepth;
+        }
+
+        DispatchScope(const DispatchScope&) = delete;
+        DispatchScope& operator=(const DispatchScope&) = delete;
+
+        ~DispatchScope() {
+            if (--event.dispatchDepth == 0 && event.HasPending()) {
+                event.ApplyPending();
+            }
+        }
+    };
+
+    //* Held by every public function using the subscribers, locks the event as its threading policy requires
+    class LockScope {
+    private:
+        const Event& event;
+
+    public:
+        explicit LockScope(const Event& event) : event{event} {
+            event.Sync::Lock();
+        }
+
+        LockScope(const LockScope&) = delete;
+        LockScope& operator=(const LockScope&) = delete;
+
+        ~LockScope() {
+            event.Sync::Unlock(event.delegates);
+        }
+    };
+
+    //* Allocates the extra state from the allocator of the event, copying or moving other if given
+    template <class Other = std::nullptr_t>
+    Extra* NewExtra(Other&& other = nullptr) {
+        ExtraAllocator allocator {slots.get_allocator()};
+        Extra* created {std::allocator_traits<ExtraAllocator>::allocate(allocator, 1)};
+        if constexpr (std::is_same_v<std::decay_t<Other>, std::nullptr_t>) {
+            ::new (static_cast<void*>(created)) Extra{slots.get_allocator()};
+        } else {
+            ::new (static_cast<void*>(created)) Extra{std::forward<Other>(other), slots.get_allocator()};
+        }
+        return created;
+    }
+
+    void DeleteExtra() {
+        if (extra) {
+            ExtraAllocator allocator {slots.get_allocator()};
+            extra->~Extra();
+            std::allocator_traits<ExtraAllocator>::deallocate(allocator, extra, 1);
+            extra = nullptr;
+        }
+    }
+
+    Extra& Extras() {
+        if (!extra) {
+            extra = NewExtra();
+        }
+        return *extra;
+    }
+
+    bool HasPending() const {
+        return extra && (!extra->disabledDelegates.empty() || !extra->changedGroups.empty() || !extra->pendingDelegates.empty() ||
+                         !extra->staleKeys.empty());
+    }
+
+    void ApplyPending() {
+        if (!HasPending()) {
+            return;
+        }
+        for (auto position : extra->disabledDelegates) {
+            delegates[position] = nullptr;
+        }
+        extra->disabledDelegates.clear();
+        for (auto position : extra->changedGroups) {
+            TidyGroup(position);
+        }
+        extra->changedGroups.clear();
+        for (auto& pending : extra->pendingDelegates) {
+            if (pending.slot != SubscriptionHandle::InvalidIndex) {
+                InsertDelegate(pending.slot, pending.priority, std::move(pending.deleg), pending.join);
+            }
+        }
+        extra->pendingDelegates.clear();
+        for (auto key : extra->staleKeys) {
+            auto found {extra->keyed.find(key)};
+            if (found != extra->keyed.end()) {
+                auto& entries {found->second};
+                entries.erase(std::remove_if(entries.begin(), entries.end(), [this](const KeyedEntry& entry) {
+                    return slots[entry.slot].generation != entry.generation;
+                }), entries.end());
+                if (entries.empty()) {
+                    extra->keyed.erase(found);
+                }
+            }
+        }
+        extra->staleKeys.clear();
+        CompactDelegates();
+    }
+
+    void LinkWaiter(Waiter& waiter) {
+        waiter.event = this;
+        waiter.generation = waitGeneration;
+        waiter.previous = lastWaiter;
+        waiter.next = nullptr;
+        (lastWaiter ? lastWaiter->next : firstWaiter) = &waiter;
+        lastWaiter = &waiter;
+    }
+
+    void UnlinkWaiter(Waiter& waiter) {
+        (waiter.previous ? waiter.previous->next : firstWaiter) = waiter.next;
+        (waiter.next ? waiter.next->previous : lastWaiter) = waiter.previous;
+        waiter.event = nullptr;
+    }
+
+    //* Resumes the coroutines that were waiting when it was called, in the order they started waiting. Coroutines that
+    //* start waiting meanwhile, e.g. a resumed one waiting again, wait for the next Invoke. A waiter is unlinked before
+    //* it is resumed, so the coroutine can destroy itself or the others.
+    void WakeWaiters(const std::remove_reference_t<Args>&... args) {
+        if (!firstWaiter) {
+            return;
+        }
+        // Waiters linked during the wake-up, here or in a nested Invoke, wait for the next Invoke
+        std::uint32_t generation {++waitGeneration};
+        while (firstWaiter && static_cast<std::int32_t>(firstWaiter->generation - generation) < 0) {
+            Waiter& waiter {*firstWaiter};
+            UnlinkWaiter(waiter);
+            waiter.wake(waiter, args...);
+        }
+    }
+
+    //* Moving an event moves its waiters along
+    void AdoptWaiters(Event& other) {
+        firstWaiter = std::exchange(other.firstWaiter, nullptr);
+        lastWaiter = std::exchange(other.lastWaiter, nullptr);
+        waitGeneration = other.waitGeneration;
+        for (Waiter* waiter = firstWaiter; waiter; waiter = waiter->next) {
+            waiter->event = this;
+        }
+    }
+
+    //* Finds an id without allocating for the lookup key, unless the id is longer than the buffer
+    static typename FuncMap::iterator FindId(FuncMap& named, const std::string& id) {
+        if constexpr (std::is_same_v<String, std::string>) {
+            return named.find(id);
+        } else {
+            char buffer[256];
+            std::pmr::monotonic_buffer_resource resource {buffer, sizeof(buffer)};
+            return named.find(String{id.data(), id.size(), &resource});
+        }
+    }
+
+    //* Times the call of the delegate until the returned scope ends, if the logging policy times handlers
+    typename Logging::HandlerScope TraceHandler(const Delegate& func) const {
+        if constexpr (Logging::TimesHandlers) {
+            std::uint32_t slot {delegateSlots[static_cast<std::size_t>(&func - delegates.data())]};
+            if (slot == GroupSlot) {
+                // A group is timed as one handler, reported as its first instance
+                const auto& members {func.Group()->slots};
+                auto first {std::find_if(members.begin(), members.end(), [](std::uint32_t member) {
+                    return member != DelegateGroup::RemovedSlot;
+                })};
+                if (first == members.end()) {
+                    return {this, DelegateGroup::RemovedSlot, 0};
+                }
+                slot = *first;
+            }
+            return {this, slot, slots[slot].generation};
+        } else {
+            return {this, 0, 0};
+        }
+    }
+
+    SubscriptionHandle HandleOf(std::uint32_t slot) const {
+        return {slot, slots[slot].generation};
+    }
+
+    static void DisconnectFrom(Connectable* event, SubscriptionHandle handle) {
+        static_cast<Event*>(event)->Unsubscribe(handle);
+    }
+
+    static bool IsConnectedTo(const Connectable* event, SubscriptionHandle handle) {
+        return static_cast<const Event*>(event)->IsSubscribed(handle);
+    }
+
+    Connection Connect(SubscriptionHandle handle) {
+        if (!anchor) {
+            anchor = std::make_shared<ConnectionAnchor>(ConnectionAnchor{this, &DisconnectFrom, &IsConnectedTo});
+        }
+        return {handle, anchor};
+    }
+
+    //* Points the slots of the delegate at position, all the instances of a group, to it
+    void SetPosition(std::size_t position) {
+        std::uint32_t slot {delegateSlots[position]};
+        if (slot == GroupSlot) {
+            for (auto member : delegates[position].Group()->slots) {
+                if (member != DelegateGroup::RemovedSlot) {
+                    slots[member].position = static_cast<std::uint32_t>(position);
+                }
+            }
+        } else if (slot != SubscriptionHandle::InvalidIndex) {
+            slots[slot].position = static_cast<std::uint32_t>(position);
+        }
+    }
+
+    void UpdatePositions(std::size_t first) {
+        for (std::size_t i = first; i < delegates.size(); ++i) {
+            SetPosition(i);
+        }
+    }
+
+    //* Inserts the delegate after all the delegates with the same or higher priority. Subscribing with the same or a
+    //* lower priority than the last delegate, the common case, is a push_back. Always a push_back with InsertionOrder.
+    //* If the delegate before it calls the same member function, the subscription joins it instead, see Join.
+    void InsertDelegate(std::uint32_t slot, int priority, Delegate&& deleg, Joiner join = nullptr) {
+        std::size_t position {delegates.size()};
+        if constexpr (Ordering::Prioritized) {
+            position = static_cast<std::size_t>(
+                std::upper_bound(priorities.begin(), priorities.end(), priority, std::greater<int>{}) - priorities.begin());
+        }
+        if (join && position > 0 && delegateSlots[position - 1] != SubscriptionHandle::InvalidIndex &&
+            (!Ordering::Prioritized || priorities[position - 1] == priority) && join(*this, position - 1, slot, deleg)) {
+            Sync::Modified();
+            return;
+        }
+
+        std::uint32_t marker {slot};
+        if (DelegateGroup* group {deleg.Group()}) {
+            group->slots.front() = slot;
+            slots[slot].member = 0;
+            marker = GroupSlot;
+        }
+        if constexpr (Ordering::Prioritized) {
+            delegates.insert(delegates.begin() + position, std::move(deleg));
+            delegateSlots.insert(delegateSlots.begin() + position, marker);
+            priorities.insert(priorities.begin() + position, priority);
+            UpdatePositions(position);
+        } else {
+            slots[slot].position = static_cast<std::uint32_t>(delegates.size());
+            delegates.push_back(std::move(deleg));
+            delegateSlots.push_back(marker);
+        }
+        Sync::Modified();
+        if (slots[slot].isKeyed) {
+            IndexKey(slot, priority);
+        }
+    }
+
+    void IndexKey(std::uint32_t slot, int priority) {
+        auto& entries {Extras().keyed[slots[slot].key]};
+        auto position {entries.end()};
+        if constexpr (Ordering::Prioritized) {
+            position = std::upper_bound(entries.begin(), entries.end(), priority, [](int priority, const KeyedEntry& entry) {
+                return priority > entry.priority;
+            });
+        }
+        entries.insert(position, {slot, slots[slot].generation, priority});
+    }
+
+    //* Removes the slot from the key index. While raising, the entry is left for ApplyPending, and skipped by
+    //* Invoke(key, args...) meanwhile because releasing the slot changes its generation.
+    void UnindexKey(std::uint32_t slot) {
+        std::uint64_t key {slots[slot].key};
+        if (dispatchDepth > 0) {
+            Extras().staleKeys.push_back(key);
+            return;
+        }
+        if (!extra) {
+            return;
+        }
+        auto found {extra->keyed.find(key)};
+        if (found != extra->keyed.end()) {
+            auto& entries {found->second};
+            auto entry {std::find_if(entries.begin(), entries.end(), [slot](const KeyedEntry& entry) {
+                return entry.slot == slot;
+            })};
+            if (entry != entries.end()) {
+                entries.erase(entry);
+            }
+            if (entries.empty()) {
+                extra->keyed.erase(found);
+            }
+        }
+    }
+
+    //* Adds the delegate to the array, or to the pending delegates while the event is being raised
+    void PlaceDelegate(std::uint32_t slot, int priority, Delegate&& deleg, Joiner join = nullptr) {
+        if (dispatchDepth > 0) {
+            auto& pendingDelegates {Extras().pendingDelegates};
+            slots[slot].position = PendingBit | static_cast<std::uint32_t>(pendingDelegates.size());
+            pendingDelegates.push_back({slot, priority, std::move(deleg), join});
+        } else {
+            InsertDelegate(slot, priority, std::move(deleg), join);
+        }
+    }
+
+    //* Leaves an empty delegate in place, skipped by Invoke, so nothing has to move. The array is compacted by
+    //* CompactDelegates once enough of them accumulate.
+    //* While the event is being raised the delegate is only disabled, because it may be the one running.
+    void EraseDelegate(std::size_t position) {
+        if (dispatchDepth > 0) {
+            delegates[position].Disable();
+            Extras().disabledDelegates.push_back(static_cast<std::uint32_t>(position));
+        } else {
+            delegates[position] = nullptr;
+        }
+        delegateSlots[position] = SubscriptionHandle::InvalidIndex;
+        ++erasedDelegates;
+        Sync::Modified();
+    }
+
+    //* Removes an instance from the group at position. The instance is only set to nullptr, so nothing moves while the
+    //* group may be running; the group is compacted or erased by TidyGroup.
+    void EraseMember(std::size_t position, std::uint32_t member) {
+        delegates[position].Group()->Remove(member);
+        Sync::Modified();
+        if (dispatchDepth > 0) {
+            Extras().changedGroups.push_back(static_cast<std::uint32_t>(position));
+        } else {
+            TidyGroup(position);
+        }
+    }
+
+    //* Erases a group without instances left, and compacts one with enough removed instances, like CompactDelegates
+    void TidyGroup(std::size_t position) {
+        if (delegateSlots[position] != GroupSlot) {
+            return; // Already erased
+        }
+        DelegateGroup& group {*delegates[position].Group()};
+        if (group.removed == group.slots.size()) {
+            EraseDelegate(position);
+        } else if (group.removed > 0 && (group.dense || group.removed * 4 > group.slots.size())) {
+            group.Compact();
+            for (std::size_t i = 0; i < group.slots.size(); ++i) {
+                slots[group.slots[i]].member = static_cast<std::uint32_t>(i);
+            }
+            Sync::Modified();
+        }
+    }
+
+    //* Erases the delegate of a slot, wherever it is
+    void EraseSlotDelegate(std::uint32_t slot) {
+        std::uint32_t position {slots[slot].position};
+        if (position & PendingBit) {
+            PendingDelegate& pending {extra->pendingDelegates[position & ~PendingBit]};
+            pending.slot = SubscriptionHandle::InvalidIndex;
+            pending.deleg = nullptr;
+        } else if (slots[slot].member != SubscriptionHandle::InvalidIndex) {
+            EraseMember(position, slots[slot].member);
+        } else {
+            EraseDelegate(position);
+        }
+        slots[slot].member = SubscriptionHandle::InvalidIndex;
+    }
+
+    //* Removes the erased delegates in one pass, keeping the order of the others. Only called from functions that
+    //* change the subscribers, never while raising the event.
+    void CompactDelegates() {
+        if (dispatchDepth > 0 || erasedDelegates * 4 <= delegates.size()) {
+            return;
+        }
+        std::size_t kept {0};
+        for (std::size_t i = 0; i < delegates.size(); ++i) {
+            if (delegateSlots[i] != SubscriptionHandle::InvalidIndex) {
+                if (kept != i) {
+                    delegates[kept] = std::move(delegates[i]);
+                    delegateSlots[kept] = delegateSlots[i];
+                    if constexpr (Ordering::Prioritized) {
+                        priorities[kept] = priorities[i];
+                    }
+                    SetPosition(kept);
+                }
+                ++kept;
+            }
+        }
+        delegates.erase(delegates.begin() + kept, delegates.end());
+        delegateSlots.resize(kept);
+        if constexpr (Ordering::Prioritized) {
+            priorities.resize(kept);
+        }
+        erasedDelegates = 0;
+    }
+
+    //* Replaces the delegate of an existing subscription, moving it if the priority changed
+    SubscriptionHandle Replace(std::uint32_t slot, int priority, Delegate&& deleg, Joiner join = nullptr) {
+        std::uint32_t position {slots[slot].position};
+        if (position & PendingBit) {
+            PendingDelegate& pending {extra->pendingDelegates[position & ~PendingBit]};
+            pending.priority = priority;
+            pending.deleg = std::move(deleg);
+            pending.join = join;
+        } else if (dispatchDepth == 0 && slots[slot].member == SubscriptionHandle::InvalidIndex && !deleg.Group() &&
+                   (!Ordering::Prioritized || priorities[position] == priority)) {
+            delegates[position] = std::move(deleg);
+            Sync::Modified();
+        } else {
+            EraseSlotDelegate(slot);
+            PlaceDelegate(slot, priority, std::move(deleg), join);
+            CompactDelegates();
+        }
+        return HandleOf(slot);
+    }
+
+    SubscriptionHandle Append(Listener& owner, const void* invoker, bool isConst, const std::string& id, int priority, Delegate&& deleg,
+                              const EventKey* key = nullptr, Joiner join = nullptr) {
+        std::uint32_t index {freeSlots};
+        if (index != SubscriptionHandle::InvalidIndex) {
+            freeSlots = slots[index].position;
+        } else {
+            index = static_cast<std::uint32_t>(slots.size());
+            slots.emplace_back();
+        }
+
+        Slot& slot {slots[index]};
+        slot.listenerPosition = static_cast<std::uint32_t>(owner.slots.size());
+        slot.owner = &owner;
+        slot.invoker = invoker;
+        slot.isConst = isConst;
+        slot.isKeyed = key != nullptr;
+        slot.key = key ? key->value : 0;
+        slot.id = id;
+        slot.member = SubscriptionHandle::InvalidIndex;
+
+        PlaceDelegate(index, priority, std::move(deleg), join);
+        owner.slots.push_back(index);
+        if (!id.empty()) {
+            owner.named.emplace(id, index);
+        }
+        Logging::Subscribed(this, index, slots[index].generation, id);
+        return HandleOf(index);
+    }
+
+    //* Removes the slot from its owner and puts it in the free list. The owner is left in the index even if empty.
+    void ReleaseSlot(std::uint32_t index) {
+        Slot& slot {slots[index]};
+
+        Listener& owner {*slot.owner};
+        if (slot.listenerPosition != owner.slots.size() - 1) {
+            owner.slots[slot.listenerPosition] = owner.slots.back();
+            slots[owner.slots[slot.listenerPosition]].listenerPosition = slot.listenerPosition;
+        }
+        owner.slots.pop_back();
+        if (!slot.id.empty()) {
+            owner.named.erase(slot.id);
+            slot.id.clear();
+        }
+
+        slot.owner = nullptr;
+        ++slot.generation;
+        slot.position = freeSlots;
+        freeSlots = index;
+    }
+
+    void Release(std::uint32_t index) {
+        Logging::Unsubscribed(this, index, slots[index].generation);
+        EraseSlotDelegate(index);
+        if (slots[index].isKeyed) {
+            UnindexKey(index);
+            slots[index].isKeyed = false;
+        }
+        ReleaseSlot(index);
+    }
+
+    //* Releases the slot and removes its owner from the index once it has no subscriptions left
+    void ReleaseAndPrune(std::uint32_t index) {
+        Listener* owner {slots[index].owner};
+        const void* invoker {slots[index].invoker};
+        bool isConst {slots[index].isConst};
+        Release(index);
+        if (owner->slots.empty()) {
+            if (isConst) {
+                constListeners.erase(invoker);
+            } else {
+                listeners.erase(const_cast<void*>(invoker));
+            }
+        }
+        CompactDelegates();
+    }
+
+    void ReleaseAll(Listener& owner) {
+        while (!owner.slots.empty()) {
+            Release(owner.slots.back());
+        }
+    }
+
+    void RelinkOwners() {
+        for (auto& listener : listeners) {
+            for (auto slot : listener.second.slots) {
+                slots[slot].owner = &listener.second;
+            }
+        }
+        for (auto& listener : constListeners) {
+            for (auto slot : listener.second.slots) {
+                slots[slot].owner = &listener.second;
+            }
+        }
+    }
+
+    //* Subscriptions of one member function that follow each other in delegates, with the same priority, are grouped
+    //* into a single delegate that calls the function for each instance in a loop: one indirect call per group instead
+    //* of one per subscriber. Since a group only takes subscriptions that would be right after it, the call order
+    //* doesn't change. Events whose handlers return a value (combiners need each result) or take rvalue references
+    //* (each handler needs its own argument) aren't grouped, neither are keyed subscriptions.
+    static constexpr bool Groupable {std::is_void_v<R> && !(std::is_rvalue_reference_v<Args> || ...)};
+
+    //* What InvokeParallel passes to DelegateGroup::callRange
+    using ParallelArguments = std::tuple<const Args&...>;
+
+    //* Whether a member function can share the arguments with the rest of its group, i.e. needs no copy of its own
+    template <class Func, class Type>
+    static constexpr bool Groups {Groupable && std::is_invocable_v<Func, Type*, typename Delegate::template SharedArg<Args>...>};
+
+    //* What a delegate of a group stores, allocated like the rest of the subscriber storage
+    template <class Group>
+    using Grouped = GroupStorage<Group, Allocator<char>>;
+
+    Allocator<char> GroupAllocator() const {
+        return Allocator<char>{slots.get_allocator()};
+    }
+
+    //* Moves the groups moved in from an event with another allocator to the allocator of this one
+    void RebindGroups() {
+        Allocator<char> allocator {GroupAllocator()};
+        auto rebind {[&](Delegate& deleg) {
+            if (GroupOwner* owner {deleg.Owner()}) {
+                owner->rebind(*owner, &allocator);
+            }
+        }};
+        for (auto& deleg : delegates) {
+            rebind(deleg);
+        }
+        if (extra) {
+            for (auto& pending : extra->pendingDelegates) {
+                rebind(pending.deleg);
+            }
+        }
+    }
+
+    //* A parameter for every instance of a group but the last one, which may take ownership like in InvokeMoveLast
+    template <class Param>
+    static decltype(auto) View(Param& param) {
+        if constexpr (std::is_lvalue_reference_v<Param>) {
+            return static_cast<Param>(param);
+        } else {
+            return std::as_const(param);
+        }
+    }
+
+    //* Calls call(instance, params...) for each instance left in the group. Nothing is added to a group while the event
+    //* is raised, and removed instances are only set to nullptr, so the array doesn't move under the loop.
+    template <class Type, class Call, class... Params>
+    static void CallEach(const std::pmr::vector<Type*>& instances, const Call& call, Params&&... params) {
+        std::size_t last {instances.size()};
+        while (last > 0 && !instances[last - 1]) {
+            --last;
+        }
+        for (std::size_t i = 0; i + 1 < last; ++i) {
+            if (instances[i]) {
+                call(instances[i], View<Params>(params)...);
+            }
+        }
+        if (last > 0 && instances[last - 1]) {
+            call(instances[last - 1], std::forward<Params>(params)...);
+        }
+    }
+
+    //* Group of Subscribe<Method>(invoker) subscriptions, the member function is called directly
+    template <auto Method, class Type>
+    struct MethodGroup : InstanceGroup<Type> {
+        using Single = typename Delegate::template MethodBinding<Method, Type>;
+
+        MethodGroup(std::pmr::memory_resource* resource, const Single& single, std::uint32_t slot) : InstanceGroup<Type>{resource} {
+            this->Append(single.invoker, slot);
+            this->callRange = &CallRange;
+        }
+
+        MethodGroup(const MethodGroup& other, std::pmr::memory_resource* resource) : InstanceGroup<Type>{other, resource} {}
+
+        static bool Matches(const Single&, const Single&) {
+            return true;
+        }
+
+        static void CallRange(const DelegateGroup& group, std::size_t first, std::size_t last, const void* arguments) {
+            const auto& instances {static_cast<const MethodGroup&>(group).instances};
+            std::apply([&](auto&... values) {
+                for (std::size_t i = first; i < last; ++i) {
+                    if (instances[i]) {
+                        (instances[i]->*Method)(values...);
+                    }
+                }
+            }, *static_cast<const ParallelArguments*>(arguments));
+        }
+
+        bool Accepts(const Single&) const {
+            return true;
+        }
+
+        std::uint32_t Add(const Single& single, std::uint32_t slot) {
+            return this->Append(single.invoker, slot);
+        }
+
+        template <class... Params>
+        void operator()(Params&&... params) const {
+            CallEach(this->instances, [](Type* instance, auto&&... args) {
+                (instance->*Method)(std::forward<decltype(args)>(args)...);
+            }, std::forward<Params>(params)...);
+        }
+    };
+
+    //* Group of Subscribe(&Type::Function, invoker) subscriptions of the same function
+    template <class Type, class Func>
+    struct MemberGroup : InstanceGroup<Type> {
+        using Single = typename Delegate::template MemberBinding<Type, Func>;
+
+        Func func;
+
+        MemberGroup(std::pmr::memory_resource* resource, const Single& single, std::uint32_t slot)
+            : InstanceGroup<Type>{resource}, func{single.func} {
+            this->Append(single.invoker, slot);
+            this->callRange = &CallRange;
+        }
+
+        MemberGroup(const MemberGroup& other, std::pmr::memory_resource* resource)
+            : InstanceGroup<Type>{other, resource}, func{other.func} {}
+
+        static bool Matches(const Single& first, const Single& second) {
+            return first.func == second.func;
+        }
+
+        static void CallRange(const DelegateGroup& group, std::size_t first, std::size_t last, const void* arguments) {
+            const MemberGroup& self {static_cast<const MemberGroup&>(group)};
+            std::apply([&](auto&... values) {
+                for (std::size_t i = first; i < last; ++i) {
+                    if (self.instances[i]) {
+                        (self.instances[i]->*self.func)(values...);
+                    }
+                }
+            }, *static_cast<const ParallelArguments*>(arguments));
+        }
+
+        bool Accepts(const Single& single) const {
+            return single.func == func;
+        }
+
+        std::uint32_t Add(const Single& single, std::uint32_t slot) {
+            return this->Append(single.invoker, slot);
+        }
+
+        template <class... Params>
+        void operator()(Params&&... params) const {
+            CallEach(this->instances, [this](Type* instance, auto&&... args) {
+                (instance->*func)(std::forward<decltype(args)>(args)...);
+            }, std::forward<Params>(params)...);
+        }
+    };
+
+    //* Group of Subscribe<&Type::Handle>(invoker) subscriptions of a static Handle(Span<Type*>, args...) function,
+    //* called once with every instance. Each subscription starts as a group of its own instance.
+    template <auto Handle, class Type>
+    struct BatchGroup : InstanceGroup<Type> {
+        using Single = BatchGroup;
+
+        BatchGroup(std::pmr::memory_resource* resource, Type* instance) : InstanceGroup<Type>{resource} {
+            this->Append(instance, DelegateGroup::RemovedSlot); // The slot is set when the delegate is inserted
+            this->dense = true;
+            this->callRange = &CallRange;
+        }
+
+        BatchGroup(const BatchGroup& other, std::pmr::memory_resource* resource) : InstanceGroup<Type>{other, resource} {}
+
+        //* Each chunk gets its part of the instances
+        static void CallRange(const DelegateGroup& group, std::size_t first, std::size_t last, const void* arguments) {
+            auto& instances {const_cast<std::pmr::vector<Type*>&>(static_cast<const BatchGroup&>(group).instances)};
+            std::apply([&](auto&... values) {
+                Handle(Span<Type*>{instances.data() + first, last - first}, values...);
+            }, *static_cast<const ParallelArguments*>(arguments));
+        }
+
+        bool Accepts(const Single&) const {
+            return true;
+        }
+
+        std::uint32_t Add(const Single& single, std::uint32_t slot) {
+            return this->Append(single.instances.front(), slot);
+        }
+
+        template <class... Params>
+        void operator()(Params&&... params) const {
+            Handle(Span<Type*>{const_cast<Type**>(this->instances.data()), this->instances.size()}, std::forward<Params>(params)...);
+        }
+    };
+
+    //* Adds the subscription in slot to the group at position, or makes a group of it and the single subscription
+    //* at position, when both call the same member function. Only called when the event isn't being raised.
+    template <class Group>
+    static bool Join(Event& event, std::size_t position, std::uint32_t slot, Delegate& deleg) {
+        using Single = typename Group::Single;
+        using Stored = Grouped<Group>;
+        const Single* single {nullptr};
+        if constexpr (std::is_same_v<Single, Group>) {
+            single = &deleg.template Target<Stored>()->Get();
+        } else {
+            single = deleg.template Target<Single>();
+        }
+        Delegate& target {event.delegates[position]};
+        if (Stored* stored {target.template Target<Stored>()}) {
+            Group& group {stored->Get()};
+            if (!group.Accepts(*single)) {
+                return false;
+            }
+            event.slots[slot].member = group.Add(*single, slot);
+        } else if constexpr (!std::is_same_v<Single, Group>) {
+            const Single* previous {target.template Target<Single>()};
+            std::uint32_t first {event.delegateSlots[position]};
+            if (!previous || first == GroupSlot || event.slots[first].isKeyed || !Group::Matches(*previous, *single)) {
+                return false;
+            }
+            Stored created {event.GroupAllocator(), *previous, first};
+            event.slots[first].member = 0;
+            event.slots[slot].member = created.Get().Add(*single, slot);
+            target = Delegate{std::move(created)};
+            event.delegateSlots[position] = GroupSlot;
+        } else {
+            return false;
+        }
+        event.slots[slot].position = static_cast<std::uint32_t>(position);
+        return true;
+    }
+
+    template <class Type, class Map, class Invoker>
+    SubscriptionHandle SubscribeMember(Map& map, Invoker* invoker, const std::string& id, int priority, Delegate&& deleg,
+                                       Joiner join = nullptr) {
+        constexpr bool isConst {std::is_const_v<Type>};
+        auto found{map.find(invoker)}; 
+
+        if (found != map.end()) {
+            Logging::Log([&](auto& out) { out << "Listener [" << id << ", " << type_name<Type>() << "] updated."; });
+            auto iter {FindId(found->second.named, id)};
+            if (iter != found->second.named.end()) {
+                Logging::Log([](auto& out) { out << " *Function was replaced.\n"; });
+                return Replace(iter->second, priority, std::move(deleg), join);
+            }
+            else { 
+                Logging::Log([](auto& out) { out << '\n'; });
+                return Append(found->second, invoker, isConst, id, priority, std::move(deleg), nullptr, join);
+            }
+        } else {
+            Logging::Log([&](auto& out) { out << "New listener [" << id << ", " << type_name<Type>() << "] registered.\n"; });
+            return Append(map[invoker], invoker, isConst, id, priority, std::move(deleg), nullptr, join);
+        }
+    }
+
+public:
+    Event() = default;
+
+    //* Copying and moving aren't synchronized by the threading policy, no other thread may use the events meanwhile
+
+    Event(const Event& other)
+        : Connectable{other}, Sync{other}, delegates{other.delegates}, delegateSlots{other.delegateSlots}, priorities{other.priorities},
+          erasedDelegates{other.erasedDelegates}, slots{other.slots}, freeSlots{other.freeSlots},
+          listeners{other.listeners}, constListeners{other.constListeners} {
+        if (other.extra) {
+            extra = NewExtra(*other.extra);
+        }
+        RelinkOwners();
+        ApplyPending(); // The copy isn't being raised
+        Sync::Publish(delegates);
+    }
+
+    /**
+     * @brief Event whose subscriber storage is allocated with the allocator. With PmrAllocation it can be a memory
+     *        resource, e.g. a std::pmr::monotonic_buffer_resource released when a level is unloaded. The resource must
+     *        outlive the event. Callables too big for a Delegate still use the global heap.
+     * 
+     * @param allocator 
+     */
+    explicit Event(const Allocator<char>& allocator)
+        : delegates{allocator}, delegateSlots{allocator}, priorities{allocator}, slots{allocator}, listeners{allocator},
+          constListeners{allocator} {}
+
+    Event(Event&& other) noexcept
+        : Connectable{std::move(other)}, Sync{other}, delegates{std::move(other.delegates)}, delegateSlots{std::move(other.delegateSlots)},
+          priorities{std::move(other.priorities)}, erasedDelegates{other.erasedDelegates}, slots{std::move(other.slots)},
+          freeSlots{other.freeSlots}, listeners{std::move(other.listeners)}, constListeners{std::move(other.constListeners)},
+          extra{std::exchange(other.extra, nullptr)}, dispatchDepth{other.dispatchDepth} {
+        other.erasedDelegates = 0;
+        other.freeSlots = SubscriptionHandle::InvalidIndex;
+        AdoptWaiters(other);
+        Sync::Publish(delegates);
+        other.Sync::Publish(other.delegates);
+    }
+
+    //* Coroutines still waiting are never resumed, whoever owns them has to destroy them
+    ~Event() {
+        for (Waiter* waiter = firstWaiter; waiter; waiter = waiter->next) {
+            waiter->event = nullptr;
+        }
+        DeleteExtra();
+    }
 
-template <class>
-class Event;
+    Event& operator=(const Event& other) {
+        if (this != &other) {
+            Event copy {other};
+            *this = std::move(copy);
+        }
+        return *this;
+    }
 
-/**
- * @brief Event that can call all of its subscribers
- * 
- * @tparam R Return type
- * @tparam Args Function arguments
- */
-template <class R, class... Args>
-class Event<R(Args...)> {
-private:
-    using Delegate = std::function<R(Args...)>;
-    using FuncMap = std::unordered_map<std::string, Delegate>;
-    std::unordered_map<void*, FuncMap> listeners;
-    std::unordered_map<const void*, FuncMap> constListeners;
+    //* Keeps the memory resource of this event. If it differs from the other one the elements are moved one by one,
+    //* so the owner pointers have to be updated.
+    Event& operator=(Event&& other) {
+        if (this != &other) {
+            Connectable::operator=(std::move(other));
+            delegates = std::move(other.delegates);
+            delegateSlots = std::move(other.delegateSlots);
+            priorities = std::move(other.priorities);
+            erasedDelegates = other.erasedDelegates;
+            slots = std::move(other.slots);
+            freeSlots = other.freeSlots;
+            listeners = std::move(other.listeners);
+            constListeners = std::move(other.constListeners);
+            DeleteExtra();
+            if (slots.get_allocator() == other.slots.get_allocator()) {
+                extra = std::exchange(other.extra, nullptr);
+            } else {
+                if (other.extra) {
+                    extra = NewExtra(std::move(*other.extra));
+                    other.DeleteExtra();
+                }
+                RebindGroups();
+            }
+            dispatchDepth = other.dispatchDepth;
+            other.erasedDelegates = 0;
+            other.freeSlots = SubscriptionHandle::InvalidIndex;
+            for (Waiter* waiter = firstWaiter; waiter; waiter = waiter->next) {
+                waiter->event = nullptr;
+            }
+            AdoptWaiters(other);
+            RelinkOwners();
+            Sync::Publish(delegates);
+            other.Sync::Publish(other.delegates);
+        }
+        return *this;
+    }
 
-public:
-    Event() = default;
+    /**
+     * @brief The memory resource the subscriber storage is allocated from. Only with PmrAllocation.
+     */
+    std::pmr::memory_resource* MemoryResource() const {
+        return slots.get_allocator().resource();
+    }
 
     /**
      * @brief Subscribes a member function to the event.
@@ -83,36 +2171,17 @@ public:
      * @param id Unique identifier of the subscribing function
      * @param func The function to call when the event is raised
      * @param invoker The instance owning the member function
+     * @param priority Subscribers with higher priority are called first, equal priorities in subscription order
+     * @return Connection to unsubscribe the function without its id
      */
     template <class Invoker, class Type>
-    void Subscribe(const std::string& id, R(Type::*func)(Args... args), Invoker* invoker) {
-        Delegate deleg {std::move(EasyBind(func, invoker))};
-
-        auto found{listeners.find(invoker)}; 
-
-        if (found != listeners.end()) {
-#ifdef EVENT_DEBUG_INFO
-            std::cout << "Listener [" << id << ", " << type_name<Type>() << "] updated.";
-#endif
-            auto iter {found->second.find(id)};
-            if (iter != found->second.end()) {
-                iter->second = std::move(deleg);
-#ifdef EVENT_DEBUG_INFO
-                std::cout << " *Function was replaced.\n";
-#endif
-            }
-            else { 
-                found->second.emplace(id, std::move(deleg));
-#ifdef EVENT_DEBUG_INFO
-                std::cout << '\n';
-#endif
-            }
-        } else {
-#ifdef EVENT_DEBUG_INFO
-            std::cout << "New listener [" << id << ", " << type_name<Type>() << "] registered.\n";
-#endif
-            listeners.emplace(invoker, FuncMap{{id, {std::move(deleg)}}});
+    Connection Subscribe(const std::string& id, R(Type::*func)(Args... args), Invoker* invoker, int priority = 0) {
+        LockScope lock {*this};
+        Joiner join {nullptr};
+        if constexpr (Groups<decltype(func), Type>) {
+            join = &Join<MemberGroup<Type, decltype(func)>>;
         }
+        return Connect(SubscribeMember<Type>(listeners, invoker, id, priority, Delegate{func, static_cast<Type*>(invoker)}, join));
     }
 
     /**
@@ -123,101 +2192,218 @@ public:
      * @param id Unique identifier of the subscribing function
      * @param func The const function to call when the event is raised
      * @param invoker The instance owning the member function
+     * @param priority Subscribers with higher priority are called first, equal priorities in subscription order
+     * @return Connection to unsubscribe the function without its id
      */
     template <class Invoker, class Type>
-    void Subscribe(const std::string& id, R (Type::*func)(Args... args) const, const Invoker* invoker) { 
-        Delegate deleg {std::move(EasyBind(func, invoker))};
-
-        auto found{constListeners.find(invoker)};
+    Connection Subscribe(const std::string& id, R (Type::*func)(Args... args) const, const Invoker* invoker, int priority = 0) { 
+        LockScope lock {*this};
+        Joiner join {nullptr};
+        if constexpr (Groups<decltype(func), const Type>) {
+            join = &Join<MemberGroup<const Type, decltype(func)>>;
+        }
+        return Connect(SubscribeMember<const Type>(constListeners, invoker, id, priority, Delegate{func, static_cast<const Type*>(invoker)},
+                                                   join));
+    }
 
-        if (found != constListeners.end()) {
-#ifdef EVENT_DEBUG_INFO
-            std::cout << "Listener [" << id << ", " << type_name<Type>() << "] updated.";
-#endif
-            auto iter {found->second.find(id)};
-            if (iter != found->second.end()) {
-                iter->second = std::move(deleg);
-#ifdef EVENT_DEBUG_INFO
-                std::cout << " *Function was replaced.\n";
-#endif
-            }
-            else {
-                found->second.emplace(id, std::move(deleg));
-#ifdef EVENT_DEBUG_INFO
-                std::cout << '\n';
-#endif
+    /**
+     * @brief Subscribes a member function known at compile time to the event, e.g. Subscribe<&Type::Function>(id, this).
+     *        The call to the member function is direct and can be inlined, unlike the overload taking the function as argument.
+     *        
+     *        Method can also be a static function taking every subscribed instance at once, e.g.
+     *        static void Handle(Span<Type*> instances, int value), subscribed with Subscribe<&Type::Handle>(this).
+     *        Instances subscribed one after another with the same priority are handed to a single call, in
+     *        subscription order. Instances unsubscribed while the event is raised are nullptr until it returns.
+     *        
+     * @tparam Method The (const) member function, or static batch function, to call when the event is raised
+     * @tparam Invoker The instance type to call the member function
+     * @param id Unique identifier of the subscribing function
+     * @param invoker The instance owning the member function
+     * @param priority Subscribers with higher priority are called first, equal priorities in subscription order
+     * @return Connection to unsubscribe the function without its id
+     */
+    template <auto Method, class Invoker>
+    Connection Subscribe(const std::string& id, Invoker* invoker, int priority = 0) {
+        LockScope lock {*this};
+        if constexpr (!std::is_member_function_pointer_v<decltype(Method)>) {
+            static_assert(Groupable && std::is_invocable_v<decltype(Method), Span<Invoker*>, typename Delegate::template SharedArg<Args>...>,
+                          "Method must be a member function, or a function taking a Span of instances and the arguments of a void event");
+            using Group = BatchGroup<Method, Invoker>;
+            if constexpr (std::is_const_v<Invoker>) {
+                return Connect(SubscribeMember<Invoker>(constListeners, invoker, id, priority,
+                                                        Delegate{Grouped<Group>{GroupAllocator(), invoker}}, &Join<Group>));
+            } else {
+                return Connect(SubscribeMember<Invoker>(listeners, invoker, id, priority,
+                                                        Delegate{Grouped<Group>{GroupAllocator(), invoker}}, &Join<Group>));
             }
         } else {
-#ifdef EVENT_DEBUG_INFO
-            std::cout << "New listener [" << id << ", const " << type_name<Type>() << "] registered.\n";
-#endif
-            constListeners.emplace(invoker, FuncMap{{id, {std::move(deleg)}}});
+            using Type = MemberFunctionClassT<decltype(Method)>;
+            Joiner join {nullptr};
+            if constexpr (Groups<decltype(Method), Type>) {
+                join = &Join<MethodGroup<Method, Type>>;
+            }
+            if constexpr (std::is_const_v<Type>) {
+                return Connect(SubscribeMember<Type>(constListeners, invoker, id, priority,
+                                                     Delegate::template Bind<Method>(static_cast<Type*>(invoker)), join));
+            } else {
+                return Connect(SubscribeMember<Type>(listeners, invoker, id, priority,
+                                                     Delegate::template Bind<Method>(static_cast<Type*>(invoker)), join));
+            }
         }
     }
 
     /**
-     * @brief Subscribes free function, lambda or capture lambda to the event
+     * @brief Subscribes free function, lambda, capture lambda or std::function to the event
      * 
      * @param id Unique identifier of the subscribing function
      * @param func The function to call when the event is raised
+     * @param priority Subscribers with higher priority are called first, equal priorities in subscription order
+     * @return Connection to unsubscribe the function without its id
      */
-    void Subscribe(const std::string& id, std::function<R(Args...)>&& func) {
+    Connection Subscribe(const std::string& id, Delegate func, int priority = 0) {
+        LockScope lock {*this};
         auto found{listeners.find(nullptr)};
 
         if (found != listeners.end()) {
-            auto iter {found->second.find(id)};
-            if (iter != found->second.end()) {
-                iter->second = std::move(func);
-#ifdef EVENT_DEBUG_INFO
-                std::cout << "Free listener [" << id << "] updated. Function replaced.\n";
-#endif
+            auto iter {FindId(found->second.named, id)};
+            if (iter != found->second.named.end()) {
+                Logging::Log([&](auto& out) { out << "Free listener [" << id << "] updated. Function replaced.\n"; });
+                return Connect(Replace(iter->second, priority, std::move(func)));
             }
             else {    
-                found->second.emplace(id, func);
-#ifdef EVENT_DEBUG_INFO
-                std::cout << "Free listener [" << id << "] registered.\n";
-#endif
+                Logging::Log([&](auto& out) { out << "Free listener [" << id << "] registered.\n"; });
+                return Connect(Append(found->second, nullptr, false, id, priority, std::move(func)));
             }
         }
         else {
-#ifdef EVENT_DEBUG_INFO
-            std::cout << "Free listener [" << id << "] registered.\n";
-#endif
-            listeners.emplace(nullptr, FuncMap{{id, {std::move(func)}}});
+            Logging::Log([&](auto& out) { out << "Free listener [" << id << "] registered.\n"; });
+            return Connect(Append(listeners[nullptr], nullptr, false, id, priority, std::move(func)));
         }
     }
 
+    //* Overloads without id. Every call adds a new subscription, which can only be removed through its handle
+    //* or RemoveListener/RemoveFreeFunctions.
+
     /**
-     * @brief Subscribes a free function or a std::function reference to the event
+     * @brief Subscribes a member function to the event without an id
      * 
-     * @param id Unique identifier of the subscribing function
      * @param func The function to call when the event is raised
+     * @param invoker The instance owning the member function
+     * @param priority Subscribers with higher priority are called first, equal priorities in subscription order
+     * @return Connection to unsubscribe the function
      */
-    void Subscribe(const std::string& id, std::function<R(Args...)>& func) {
-        auto found{listeners.find(nullptr)};
+    template <class Invoker, class Type>
+    Connection Subscribe(R(Type::*func)(Args... args), Invoker* invoker, int priority = 0) {
+        return Subscribe(std::string{}, func, invoker, priority);
+    }
 
-        if (found != listeners.end()) {
-            auto iter{found->second.find(id)};
-            if (iter != found->second.end()) {
-                iter->second = func;
-#ifdef EVENT_DEBUG_INFO
-                std::cout << "Free listener [" << id << "] updated. Function replaced.\n";
-#endif
-            }
-            else {
-                found->second.emplace(id, func);
-#ifdef EVENT_DEBUG_INFO
-                std::cout << "Free listener [" << id << "] registered.\n";
-#endif
-            }
+    /**
+     * @brief Subscribes a const member function to the event without an id
+     * 
+     * @param func The const function to call when the event is raised
+     * @param invoker The instance owning the member function
+     * @param priority Subscribers with higher priority are called first, equal priorities in subscription order
+     * @return Connection to unsubscribe the function
+     */
+    template <class Invoker, class Type>
+    Connection Subscribe(R (Type::*func)(Args... args) const, const Invoker* invoker, int priority = 0) {
+        return Subscribe(std::string{}, func, invoker, priority);
+    }
+
+    /**
+     * @brief Subscribes a member function known at compile time to the event without an id, e.g. Subscribe<&Type::Function>(this)
+     * 
+     * @param invoker The instance owning the member function
+     * @param priority Subscribers with higher priority are called first, equal priorities in subscription order
+     * @return Connection to unsubscribe the function
+     */
+    template <auto Method, class Invoker>
+    Connection Subscribe(Invoker* invoker, int priority = 0) {
+        return Subscribe<Method>(std::string{}, invoker, priority);
+    }
+
+    /**
+     * @brief Subscribes free function, lambda, capture lambda or std::function to the event without an id
+     * 
+     * @param func The function to call when the event is raised
+     * @param priority Subscribers with higher priority are called first, equal priorities in subscription order
+     * @return Connection to unsubscribe the function
+     */
+    Connection Subscribe(Delegate func, int priority = 0) {
+        return Subscribe(std::string{}, std::move(func), priority);
+    }
+
+    //* Keyed overloads. The function is called by Invoke(key, args...) with the same key, and by Invoke(args...) like
+    //* any other subscriber. Keyed subscriptions have no id; remove them through their handle or RemoveListener/RemoveFreeFunctions.
+
+    /**
+     * @brief Subscribes a member function that is only called for the key, e.g. Subscribe(EventKey{entityId}, &Type::Function, this)
+     * 
+     * @param key Key passed to Invoke(key, args...)
+     * @param func The function to call when the event is raised with the key
+     * @param invoker The instance owning the member function
+     * @param priority Subscribers with higher priority are called first, equal priorities in subscription order
+     * @return Connection to unsubscribe the function
+     */
+    template <class Invoker, class Type>
+    Connection Subscribe(EventKey key, R(Type::*func)(Args... args), Invoker* invoker, int priority = 0) {
+        LockScope lock {*this};
+        Logging::Log([&](auto& out) { out << "Keyed listener [#" << key.value << ", " << type_name<Type>() << "] registered.\n"; });
+        return Connect(Append(listeners[invoker], invoker, false, std::string{}, priority, Delegate{func, static_cast<Type*>(invoker)}, &key));
+    }
+
+    /**
+     * @brief Subscribes a const member function that is only called for the key
+     * 
+     * @param key Key passed to Invoke(key, args...)
+     * @param func The const function to call when the event is raised with the key
+     * @param invoker The instance owning the member function
+     * @param priority Subscribers with higher priority are called first, equal priorities in subscription order
+     * @return Connection to unsubscribe the function
+     */
+    template <class Invoker, class Type>
+    Connection Subscribe(EventKey key, R (Type::*func)(Args... args) const, const Invoker* invoker, int priority = 0) {
+        LockScope lock {*this};
+        Logging::Log([&](auto& out) { out << "Keyed listener [#" << key.value << ", " << type_name<const Type>() << "] registered.\n"; });
+        return Connect(Append(constListeners[invoker], invoker, true, std::string{}, priority, Delegate{func, static_cast<const Type*>(invoker)}, &key));
+    }
+
+    /**
+     * @brief Subscribes a member function known at compile time that is only called for the key, e.g. Subscribe<&Type::Function>(key, this)
+     * 
+     * @param key Key passed to Invoke(key, args...)
+     * @param invoker The instance owning the member function
+     * @param priority Subscribers with higher priority are called first, equal priorities in subscription order
+     * @return Connection to unsubscribe the function
+     */
+    template <auto Method, class Invoker>
+    Connection Subscribe(EventKey key, Invoker* invoker, int priority = 0) {
+        using Type = MemberFunctionClassT<decltype(Method)>;
+        LockScope lock {*this};
+        Logging::Log([&](auto& out) { out << "Keyed listener [#" << key.value << ", " << type_name<Type>() << "] registered.\n"; });
+        if constexpr (std::is_const_v<Type>) {
+            return Connect(Append(constListeners[invoker], invoker, true, std::string{}, priority,
+                          Delegate::template Bind<Method>(static_cast<Type*>(invoker)), &key));
         } else {
-#ifdef EVENT_DEBUG_INFO
-            std::cout << "Free listener [" << id << "] registered.\n";
-#endif
-            listeners.emplace(nullptr, FuncMap{{id, {func}}});
+            return Connect(Append(listeners[invoker], invoker, false, std::string{}, priority,
+                          Delegate::template Bind<Method>(static_cast<Type*>(invoker)), &key));
         }
     }
 
+    /**
+     * @brief Subscribes free function, lambda, capture lambda or std::function that is only called for the key
+     * 
+     * @param key Key passed to Invoke(key, args...)
+     * @param func The function to call when the event is raised with the key
+     * @param priority Subscribers with higher priority are called first, equal priorities in subscription order
+     * @return Connection to unsubscribe the function
+     */
+    Connection Subscribe(EventKey key, Delegate func, int priority = 0) {
+        LockScope lock {*this};
+        Logging::Log([&](auto& out) { out << "Keyed free listener [#" << key.value << "] registered.\n"; });
+        return Connect(Append(listeners[nullptr], nullptr, false, std::string{}, priority, std::move(func), &key));
+    }
+
     /**
      * @brief Unsubscribes a member function from an event
      * 
@@ -227,25 +2413,19 @@ public:
      */
     template <class Invoker>
     void Unsubscribe(const std::string& id, Invoker* invoker) {    
+        LockScope lock {*this};
         auto found {listeners.find(invoker)};
 
         if (found != listeners.end()) {
-            auto iter {found->second.find(id)};
-            if (iter != found->second.end()) {
-                found->second.erase(iter);
-#ifdef EVENT_DEBUG_INFO
-                std::cout << "Listener [" << id << ", " << type_name<decltype(invoker)>() << "] removed.\n";
-#endif
-            }
-            if (found->second.empty()) {
-                listeners.erase(found);
+            auto iter {FindId(found->second.named, id)};
+            if (iter != found->second.named.end()) {
+                Logging::Log([&](auto& out) { out << "Listener [" << id << ", " << type_name<decltype(invoker)>() << "] removed.\n"; });
+                ReleaseAndPrune(iter->second);
             }
         }
-#ifdef EVENT_DEBUG_INFO
         else {
-            std::cout << "No member function [" << id << ", " << type_name<decltype(invoker)>() << "] was found.\n";
+            Logging::Log([&](auto& out) { out << "No member function [" << id << ", " << type_name<decltype(invoker)>() << "] was found.\n"; });
         }
-#endif
     }
 
     /**
@@ -257,25 +2437,19 @@ public:
      */
     template <class Invoker>
     void Unsubscribe(const std::string& id, const Invoker* invoker) {
+        LockScope lock {*this};
         auto found{constListeners.find(invoker)};
 
         if (found != constListeners.end()) {
-            auto iter{found->second.find(id)};
-            if (iter != found->second.end()) {
-                found->second.erase(iter);
-#ifdef EVENT_DEBUG_INFO
-                std::cout << "Listener [" << id << ", " << type_name<decltype(invoker)>() << "] removed.\n";
-#endif
-            }
-            if (found->second.empty()) {
-                listeners.erase(found);
+            auto iter{FindId(found->second.named, id)};
+            if (iter != found->second.named.end()) {
+                Logging::Log([&](auto& out) { out << "Listener [" << id << ", " << type_name<decltype(invoker)>() << "] removed.\n"; });
+                ReleaseAndPrune(iter->second);
             }
         }
-#ifdef EVENT_DEBUG_INFO
         else {
-            std::cout << "No member function [" << id << ", " << type_name<decltype(invoker)>() << "] was found.\n";
+            Logging::Log([&](auto& out) { out << "No member function [" << id << ", " << type_name<decltype(invoker)>() << "] was found.\n"; });
         }
-#endif
     }
 
         /**
@@ -284,25 +2458,46 @@ public:
      * @param id Unique identifier of the subscribed function/lambda
      */
     void Unsubscribe(const std::string& id) {
+        LockScope lock {*this};
         auto found{listeners.find(nullptr)};
 
         if (found != listeners.end()) {
-            auto iter{found->second.find(id)};
-            if (iter != found->second.end()) {
-                found->second.erase(iter);
-#ifdef EVENT_DEBUG_INFO
-                std::cout << "Free listener [" << id << "] removed.\n";
-#endif
-            }
-            if (found->second.empty()) {
-                listeners.erase(found);
+            auto iter{FindId(found->second.named, id)};
+            if (iter != found->second.named.end()) {
+                Logging::Log([&](auto& out) { out << "Free listener [" << id << "] removed.\n"; });
+                ReleaseAndPrune(iter->second);
             }
         }
-#ifdef EVENT_DEBUG_INFO
         else {
-            std::cout << "No free function [" << id << "] was found.\n";
+            Logging::Log([&](auto& out) { out << "No free function [" << id << "] was found.\n"; });
         }
-#endif
+    }
+
+    /**
+     * @brief Unsubscribes the function the handle refers to, in constant time. Does nothing if it was already removed.
+     * 
+     * @param handle Handle returned by Subscribe
+     */
+    void Unsubscribe(SubscriptionHandle handle) {
+        LockScope lock {*this};
+        if (IsSubscribed(handle)) {
+            Logging::Log([&](auto& out) { out << "Listener [#" << handle.index << ", " << slots[handle.index].id << "] removed.\n"; });
+            ReleaseAndPrune(handle.index);
+        }
+        else {
+            Logging::Log([&](auto& out) { out << "No function with handle [#" << handle.index << "] was found.\n"; });
+        }
+    }
+
+    /**
+     * @brief Checks if the subscription the handle refers to is still in this event
+     * 
+     * @param handle Handle returned by Subscribe
+     */
+    bool IsSubscribed(SubscriptionHandle handle) const {
+        LockScope lock {*this};
+        return handle.index < slots.size() && slots[handle.index].generation == handle.generation &&
+               slots[handle.index].owner != nullptr;
     }
 
     /**
@@ -312,12 +2507,15 @@ public:
      */
     template <class Invoker>
     void RemoveListener(Invoker* invoker) {
+        LockScope lock {*this};
         auto found {listeners.find(invoker)};
         if (found != listeners.end()) {
+            ReleaseAll(found->second);
             listeners.erase(found);
-#ifdef EVENT_DEBUG_INFO
-            std::cout << "All member functions from an instance of type <" << type_name<decltype(invoker)>() << "> were removed.\n";
-#endif
+            CompactDelegates();
+            Logging::Log([&](auto& out) {
+                out << "All member functions from an instance of type <" << type_name<decltype(invoker)>() << "> were removed.\n";
+            });
         }
     }
 
@@ -328,12 +2526,15 @@ public:
      */
     template <class Invoker>
     void RemoveListener(const Invoker* invoker) {
+        LockScope lock {*this};
         auto found{constListeners.find(invoker)};
         if (found != constListeners.end()) {
+            ReleaseAll(found->second);
             constListeners.erase(found);
-#ifdef EVENT_DEBUG_INFO
-            std::cout << "All member functions from an instance of type <" << type_name<decltype(invoker)>() << "> were removed.\n";
-#endif
+            CompactDelegates();
+            Logging::Log([&](auto& out) {
+                out << "All member functions from an instance of type <" << type_name<decltype(invoker)>() << "> were removed.\n";
+            });
         }
     }
 
@@ -341,36 +2542,271 @@ public:
      * @brief Unsubscribes all free functions/lambdas from this event
      */
     void RemoveFreeFunctions() {
+        LockScope lock {*this};
         auto found{listeners.find(nullptr)};
         if (found != listeners.end()) {
+            ReleaseAll(found->second);
             listeners.erase(found);
-#ifdef EVENT_DEBUG_INFO
-            std::cout << "All free functions were removed.\n";
-#endif
+            CompactDelegates();
+            Logging::Log([](auto& out) { out << "All free functions were removed.\n"; });
         }
     }
 
-    // TODO: Check if args should be lvalues or not. 
     /**
-     * @brief Calls all subscribed functions 
+     * @brief Calls all subscribed functions. Handlers can subscribe, unsubscribe and raise this event again:
+     *        removed functions aren't called anymore, and new ones are added after the outermost Invoke returns.
+     *        With LockFreeThreaded it calls the last published snapshot of the subscribers without locking.
+     * 
+     *        Every subscriber gets a const view of the same arguments, so none of them can move the arguments away
+     *        from the others. Arguments are only copied for subscribers that take them by value, or by rvalue
+     *        reference for events with rvalue reference arguments. See InvokeMoveLast to hand them to the last one.
      * 
      * @param args 
      */
-    void Invoke(Args... args) {
-#ifdef EVENT_DEBUG_INFO
-        std::cout << "\n>> Calling all listeners...\n\n";
-#endif
-        for (auto& listener : listeners) {
-            for (auto& func : listener.second) {
-                func.second(std::forward<decltype(args)>(args)...);
+    void Invoke(InvokeArg<Args>... args) {
+        Logging::Log([](auto& out) { out << "\n>> Calling all listeners...\n\n"; });
+        typename Logging::InvokeScope trace {this};
+        if constexpr (Sync::LockFreeInvoke) {
+            Sync::Read([&](const auto& snapshot) {
+                for (auto& func : snapshot) {
+                    func.CallShared(args...);
+                }
+            });
+        } else {
+            LockScope lock {*this};
+            DispatchScope scope {*this};
+            for (auto& func : delegates) {
+                if (func) {
+                    auto handlerTrace {TraceHandler(func)};
+                    func.CallShared(args...);
+                }
             }
+            WakeWaiters(args...);
         }
+    }
 
-        for (auto& listener : constListeners) {
-            for (auto& func : listener.second) {
-                func.second(std::forward<decltype(args)>(args)...);
+    /**
+     * @brief Same as Invoke, but the last subscriber called takes ownership of the arguments: it gets them as rvalues,
+     *        so one taking them by value moves them instead of copying, e.g. the one storing the payload. The other
+     *        subscribers get const views as in Invoke. If the last subscriber is unsubscribed by an earlier one, nobody
+     *        takes the arguments.
+     * 
+     * @param args Moved into Invoke when given as rvalues
+     */
+    void InvokeMoveLast(Args... args) {
+        Logging::Log([](auto& out) { out << "\n>> Calling all listeners, the last one takes the arguments...\n\n"; });
+        typename Logging::InvokeScope trace {this};
+        if constexpr (Sync::LockFreeInvoke) {
+            Sync::Read([&](const auto& snapshot) {
+                for (std::size_t i = 0; i < snapshot.size(); ++i) {
+                    if (i + 1 < snapshot.size()) {
+                        snapshot[i].CallShared(args...);
+                    } else {
+                        snapshot[i].CallOwning(args...);
+                    }
+                }
+            });
+        } else {
+            LockScope lock {*this};
+            DispatchScope scope {*this};
+            WakeWaiters(args...); // Before the last subscriber takes the arguments
+            // Nothing is added to the array while raising, so the last subscriber is known before calling any
+            std::size_t last {delegates.size()};
+            while (last > 0 && !delegates[last - 1]) {
+                --last;
+            }
+            for (std::size_t i = 0; i < last; ++i) {
+                auto& func {delegates[i]};
+                if (func) {
+                    auto handlerTrace {TraceHandler(func)};
+                    if (i + 1 < last) {
+                        func.CallShared(args...);
+                    } else {
+                        func.CallOwning(args...);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Calls only the functions subscribed with the key, looked up in an index, so the cost depends on the
+     *        number of matching subscribers instead of all of them
+     * 
+     * @param key Key given to Subscribe(key, ...)
+     * @param args 
+     */
+    void Invoke(EventKey key, InvokeArg<Args>... args) {
+        Logging::Log([&](auto& out) { out << "\n>> Calling listeners with key [#" << key.value << "]...\n\n"; });
+        LockScope lock {*this};
+        if (!extra) {
+            return;
+        }
+        auto found {extra->keyed.find(key.value)};
+        if (found == extra->keyed.end()) {
+            return;
+        }
+        typename Logging::InvokeScope trace {this};
+        DispatchScope scope {*this};
+        // The index isn't changed while raising, only slots can grow, so they're looked up on every iteration
+        for (auto& entry : found->second) {
+            if (slots[entry.slot].generation == entry.generation) {
+                auto& func {delegates[slots[entry.slot].position]};
+                if (func) {
+                    typename Logging::HandlerScope handlerTrace {this, entry.slot, entry.generation};
+                    func.CallShared(args...);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Calls the subscribed functions and aggregates their results with the combiner, e.g. 
+     *        Invoke(CombineSum<float>{}, args...). Stops calling subscribers when the combiner returns false.
+     * 
+     * @param combiner Receives each result, see CombineFirst, CombineLast, CombineSum, CombineAllOf, CombineAnyOf and CombineInto
+     * @param args 
+     * @return combiner.Result()
+     */
+    template <class Combiner>
+    auto Invoke(Combiner&& combiner, InvokeArg<Args>... args) {
+        static_assert(!std::is_void_v<R>, "Only events that return a value can combine the results");
+        Logging::Log([](auto& out) { out << "\n>> Calling listeners and combining the results...\n\n"; });
+        typename Logging::InvokeScope trace {this};
+        if constexpr (Sync::LockFreeInvoke) {
+            Sync::Read([&](const auto& snapshot) {
+                for (auto& func : snapshot) {
+                    if (!combiner(func.CallShared(args...))) {
+                        break;
+                    }
+                }
+            });
+        } else {
+            LockScope lock {*this};
+            DispatchScope scope {*this};
+            for (auto& func : delegates) {
+                if (!func) {
+                    continue;
+                }
+                auto handlerTrace {TraceHandler(func)};
+                if (!combiner(func.CallShared(args...))) {
+                    break;
+                }
+            }
+            WakeWaiters(args...);
+        }
+        return combiner.Result();
+    }
+
+    /**
+     * @brief Calls the subscribed functions and aggregates their results with a default constructed combiner, 
+     *        e.g. Invoke<CombineAllOf>(args...)
+     * 
+     * @tparam Combiner See Invoke(combiner, args...)
+     * @param args 
+     * @return The aggregated result
+     */
+    template <class Combiner>
+    auto Invoke(InvokeArg<Args>... args) {
+        return Invoke(Combiner{}, std::forward<decltype(args)>(args)...);
+    }
+
+    /**
+     * @brief Calls all subscribed functions split in chunks run in parallel by the executor, and returns once
+     *        all of them were called. The arguments are shared by reference between the chunks, so the handlers
+     *        must be safe to run concurrently and must not subscribe or unsubscribe from this event.
+     *        Grouped subscriptions (see Subscribe) are split by instance, so a group of many subscribers of the same
+     *        member function is spread over the chunks like separate subscribers.
+     * 
+     * @param executor Runs the chunks
+     * @param args 
+     */
+    void InvokeParallel(EventExecutor& executor, const Args&... args) {
+        static_assert(!(std::is_rvalue_reference_v<Args> || ...),
+                      "The same arguments are passed to all the subscribers, they can't be rvalue references");
+        Logging::Log([](auto& out) { out << "\n>> Calling all listeners in parallel...\n\n"; });
+        LockScope lock {*this};
+
+        // The work is counted in subscribers: one per delegate, or one per instance of a group
+        std::size_t units {0};
+        bool grouped {false};
+        for (std::size_t i = 0; i < delegates.size(); ++i) {
+            if (delegateSlots[i] == GroupSlot) {
+                units += delegates[i].Group()->slots.size();
+                grouped = true;
+            } else {
+                ++units;
+            }
+        }
+
+        constexpr std::size_t minChunkSize {16};
+        // A few chunks per thread lets threads that finish early steal work from the others
+        // An executor that runs everything on the calling thread may report no concurrency
+        std::size_t chunks {std::max<std::size_t>(1, executor.Concurrency()) * 4};
+        std::size_t chunkSize {(units + chunks - 1) / chunks};
+        if (chunkSize < minChunkSize) {
+            chunkSize = minChunkSize;
+        }
+        chunks = (units + chunkSize - 1) / chunkSize;
+
+        //* Where a chunk starts: a delegate, and the first instance to call if it is a group
+        struct ChunkStart {
+            std::size_t position;
+            std::size_t member;
+        };
+        // Without groups a chunk starts at a delegate, with groups the starts are found in one pass
+        std::vector<ChunkStart> starts;
+        if (grouped) {
+            starts.reserve(chunks);
+            std::size_t unit {0};
+            for (std::size_t i = 0; i < delegates.size() && starts.size() < chunks; ++i) {
+                std::size_t size {delegateSlots[i] == GroupSlot ? delegates[i].Group()->slots.size() : 1};
+                while (starts.size() < chunks && starts.size() * chunkSize < unit + size) {
+                    starts.push_back({i, starts.size() * chunkSize - unit});
+                }
+                unit += size;
             }
         }
+
+        // Capturing the arguments as one tuple keeps the task small enough to be stored inline in the Delegate
+        ParallelArguments arguments {args...};
+        auto task {[this, chunkSize, &starts, &arguments](std::size_t chunk) {
+            ChunkStart start {starts.empty() ? ChunkStart{chunk * chunkSize, 0} : starts[chunk]};
+            std::size_t remaining {chunkSize};
+            for (std::size_t i = start.position; i < delegates.size() && remaining > 0; ++i) {
+                auto& func {delegates[i]};
+                if (delegateSlots[i] == GroupSlot) {
+                    const DelegateGroup& group {*func.Group()};
+                    std::size_t first {i == start.position ? start.member : 0};
+                    std::size_t last {group.slots.size() - first < remaining ? group.slots.size() : first + remaining};
+                    remaining -= last - first;
+                    if (func) {
+                        auto handlerTrace {TraceHandler(func)};
+                        group.callRange(group, first, last, &arguments);
+                    }
+                } else {
+                    --remaining;
+                    if (func) {
+                        auto handlerTrace {TraceHandler(func)};
+                        std::apply([&](auto&... values) { func.CallShared(values...); }, arguments);
+                    }
+                }
+            }
+        }};
+        typename Logging::InvokeScope trace {this};
+        DispatchScope scope {*this};
+        executor.ParallelFor(chunks, task);
+        WakeWaiters(args...);
+    }
+
+    /**
+     * @brief Calls all subscribed functions in parallel on ThreadPool::Default(). Requires including ThreadPool.hpp.
+     * 
+     * @param args 
+     */
+    template <class Pool = ThreadPool>
+    void InvokeParallel(const Args&... args) {
+        InvokeParallel(Pool::Default(), args...);
     }
 
     /**
@@ -378,9 +2814,99 @@ public:
      * 
      * @param args 
      */
-    void operator()(Args... args) {
+    void operator()(InvokeArg<Args>... args) {
         Invoke(std::forward<decltype(args)>(args)...);
     }
 
+#ifdef EVENT_COROUTINES
+    using AwaitResult = typename EventAwaitResult<Args...>::type;
+
+    /**
+     * @brief Awaitable of co_await event and co_await event.Next(scheduler). It is the list node itself, kept in the
+     *        coroutine frame while it waits, so waiting allocates nothing. Destroying the waiting coroutine removes
+     *        it from the event.
+     */
+    class Awaiter : private Waiter {
+    private:
+        friend class Event;
+
+        Event* target;
+        EventScheduler* scheduler;
+        std::coroutine_handle<> coroutine;
+        std::optional<std::tuple<std::decay_t<Args>...>> values;
+
+        Awaiter(Event& event, EventScheduler* scheduler) : target{&event}, scheduler{scheduler} {
+            this->wake = &Wake;
+        }
+
+        static void Wake(Waiter& waiter, const std::remove_reference_t<Args>&... args) {
+            Awaiter& awaiter {static_cast<Awaiter&>(waiter)};
+            awaiter.values.emplace(args...);
+            if (awaiter.scheduler) {
+                awaiter.scheduler->Schedule(awaiter.coroutine);
+            } else {
+                awaiter.coroutine.resume();
+            }
+        }
+
+    public:
+        Awaiter(const Awaiter&) = delete;
+        Awaiter& operator=(const Awaiter&) = delete;
+
+        ~Awaiter() {
+            if (Event* event {this->event}) {
+                LockScope lock {*event};
+                event->UnlinkWaiter(*this);
+            }
+        }
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            coroutine = handle;
+            LockScope lock {*target};
+            target->LinkWaiter(*this);
+        }
+
+        AwaitResult await_resume() {
+            if constexpr (sizeof...(Args) == 1) {
+                return std::get<0>(std::move(*values));
+            } else if constexpr (sizeof...(Args) > 1) {
+                return std::move(*values);
+            }
+        }
+    };
+
+    /**
+     * @brief co_await event suspends the coroutine until the next Invoke, which resumes it once the subscribers were
+     *        called (before them with InvokeMoveLast) with a copy of the arguments as the result, e.g.
+     *        int damage {co_await onDamage}; or auto [x, y] {co_await onMove};
+     *        The coroutine is resumed inside Invoke, use Next(scheduler) to resume it somewhere else.
+     *        Invoke(key, args...) doesn't resume waiters, and LockFreeThreaded events can't be awaited since checking
+     *        for waiters would make their Invoke lock.
+     */
+    Awaiter operator co_await() {
+        static_assert(!Sync::LockFreeInvoke, "Events with the LockFreeThreaded policy can't be awaited");
+        static_assert((std::is_copy_constructible_v<std::decay_t<Args>> && ...),
+                      "co_await returns a copy of the arguments, they must be copyable");
+        return Awaiter{*this, nullptr};
+    }
+
+    /**
+     * @brief Like co_await event, but the coroutine is resumed by the scheduler, e.g. on another thread:
+     *        co_await event.Next(scheduler). The arguments are copied before Invoke returns.
+     * 
+     * @param scheduler Resumes the coroutine, must outlive the wait
+     */
+    Awaiter Next(EventScheduler& scheduler) {
+        static_assert(!Sync::LockFreeInvoke, "Events with the LockFreeThreaded policy can't be awaited");
+        static_assert((std::is_copy_constructible_v<std::decay_t<Args>> && ...),
+                      "co_await returns a copy of the arguments, they must be copyable");
+        return Awaiter{*this, &scheduler};
+    }
+#endif
+
 };
 #endif // __EVENT_H__
\ No newline at end of file
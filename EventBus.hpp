@@ -0,0 +1,171 @@
+#ifndef __EVENT_BUS_H__
+#define __EVENT_BUS_H__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Event.hpp"
+
+//* Index of each event payload type in the EventBus tables. Every type gets the next free index the first time it's used,
+//* without RTTI or type names, and keeps it for the rest of the program.
+inline std::uint32_t NextEventTypeId() {
+    static std::atomic<std::uint32_t> next {0};
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <class T>
+std::uint32_t EventTypeId() {
+    static const std::uint32_t id {NextEventTypeId()};
+    return id;
+}
+
+/**
+ * @brief Set of events indexed by payload type, so publishers and subscribers only need to share the bus instead of
+ *        every Event instance, e.g. bus.Subscribe<DamageEvent>(&Player::OnDamage, this) and bus.Publish(DamageEvent{10}).
+ *        Each payload type has its own Event<void(const T&)>, found with an array index, and Publish is an Invoke on it.
+ *
+ *        Like Event, the bus is not thread safe.
+ */
+class EventBus {
+private:
+    //* Type erased Event<void(const T&)>, heap allocated so growing the table doesn't move events being raised
+    struct Channel {
+        virtual ~Channel() = default;
+        virtual void RemoveListener(void* invoker) = 0;
+        virtual void RemoveListener(const void* invoker) = 0;
+    };
+
+    template <class T>
+    struct TypedChannel final : Channel {
+        Event<void(const T&)> event;
+
+        void RemoveListener(void* invoker) override {
+            event.RemoveListener(invoker);
+        }
+
+        void RemoveListener(const void* invoker) override {
+            event.RemoveListener(invoker);
+        }
+    };
+
+    std::vector<std::unique_ptr<Channel>> channels; // Indexed by EventTypeId
+
+    //* Event of T, or nullptr if nothing subscribed to T yet
+    template <class T>
+    Event<void(const T&)>* Find() const {
+        std::uint32_t id {EventTypeId<T>()};
+        if (id < channels.size() && channels[id]) {
+            return &static_cast<TypedChannel<T>&>(*channels[id]).event;
+        }
+        return nullptr;
+    }
+
+public:
+    EventBus() = default;
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+    EventBus(EventBus&&) = default;
+    EventBus& operator=(EventBus&&) = default;
+
+    /**
+     * @brief Bus shared by the whole program
+     */
+    static EventBus& Global() {
+        static EventBus bus;
+        return bus;
+    }
+
+    /**
+     * @brief The event raised when T is published, created on first use. Takes every Subscribe/Unsubscribe overload of Event.
+     *
+     * @tparam T Payload type
+     */
+    template <class T>
+    Event<void(const T&)>& Get() {
+        std::uint32_t id {EventTypeId<T>()};
+        if (id >= channels.size()) {
+            channels.resize(id + 1);
+        }
+        if (!channels[id]) {
+            channels[id] = std::make_unique<TypedChannel<T>>();
+        }
+        return static_cast<TypedChannel<T>&>(*channels[id]).event;
+    }
+
+    /**
+     * @brief Subscribes to the payload type T, taking the same arguments as Event::Subscribe,
+     *        e.g. Subscribe<DamageEvent>(&Player::OnDamage, this) or Subscribe<DamageEvent>([](const DamageEvent& damage) {...})
+     *
+     * @tparam T Payload type
+     * @return Connection to unsubscribe the function, or Unsubscribe<T>(handle)
+     */
+    template <class T, class... Params>
+    Connection Subscribe(Params&&... params) {
+        return Get<T>().Subscribe(std::forward<Params>(params)...);
+    }
+
+    /**
+     * @brief Subscribes a member function known at compile time to the payload type T, e.g. Subscribe<DamageEvent, &Player::OnDamage>(this)
+     *
+     * @tparam T Payload type
+     * @tparam Method The (const) member function to call when T is published
+     * @param invoker The instance owning the member function
+     * @param priority Subscribers with higher priority are called first, equal priorities in subscription order
+     * @return Connection to unsubscribe the function, or Unsubscribe<T>(handle)
+     */
+    template <class T, auto Method, class Invoker>
+    Connection Subscribe(Invoker* invoker, int priority = 0) {
+        return Get<T>().template Subscribe<Method>(invoker, priority);
+    }
+
+    /**
+     * @brief Same as above with an id, e.g. Subscribe<DamageEvent, &Player::OnDamage>("Damage", this)
+     */
+    template <class T, auto Method, class Invoker>
+    Connection Subscribe(const std::string& id, Invoker* invoker, int priority = 0) {
+        return Get<T>().template Subscribe<Method>(id, invoker, priority);
+    }
+
+    /**
+     * @brief Unsubscribes from the payload type T, taking the same arguments as Event::Unsubscribe
+     *
+     * @tparam T Payload type
+     */
+    template <class T, class... Params>
+    void Unsubscribe(Params&&... params) {
+        if (auto event {Find<T>()}) {
+            event->Unsubscribe(std::forward<Params>(params)...);
+        }
+    }
+
+    /**
+     * @brief Unsubscribes all functions owned by the invoker instance from every payload type
+     *
+     * @param invoker Instance subscribed to this bus
+     */
+    template <class Invoker>
+    void RemoveListener(Invoker* invoker) {
+        for (auto& channel : channels) {
+            if (channel) {
+                channel->RemoveListener(invoker);
+            }
+        }
+    }
+
+    /**
+     * @brief Calls every function subscribed to the payload type
+     *
+     * @param payload
+     */
+    template <class T>
+    void Publish(const T& payload) {
+        if (auto event {Find<T>()}) {
+            event->Invoke(payload);
+        }
+    }
+};
+#endif // __EVENT_BUS_H__
@@ -0,0 +1,34 @@
+#ifndef __EVENT_LOGGING_H__
+#define __EVENT_LOGGING_H__
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Logging policy printing to the console when a subscriber is created, removed, updated or replaced, and when
+ *        the event is raised, e.g. Event<void(int), EventPolicy<ConsoleLogging>>. The default when EVENT_DEBUG_INFO
+ *        is defined. Kept out of Event.hpp so that events without it don't pull in <iostream>.
+ */
+struct ConsoleLogging {
+    static constexpr bool TimesHandlers {false};
+
+    template <class Message>
+    static void Log(Message&& message) {
+        message(std::cout);
+    }
+
+    static void Subscribed(const void*, std::uint32_t, std::uint32_t, const std::string&) {}
+
+    static void Unsubscribed(const void*, std::uint32_t, std::uint32_t) {}
+
+    struct InvokeScope {
+        explicit InvokeScope(const void*) {}
+    };
+
+    struct HandlerScope {
+        HandlerScope(const void*, std::uint32_t, std::uint32_t) {}
+    };
+};
+
+#endif // __EVENT_LOGGING_H__
@@ -0,0 +1,357 @@
+#ifndef __EVENT_RECORDING_H__
+#define __EVENT_RECORDING_H__
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ArgumentLayout.hpp"
+#include "Event.hpp"
+
+/**
+ * @brief Binary format shared by EventRecorder and EventReplayer: a header followed by fixed size records, one per
+ *        raise, appended in the order the events were raised. A recording cut short (e.g. by a crash) only loses
+ *        the records after the last flush.
+ *
+ * @tparam Args Arguments of the recorded events, trivially copyable
+ */
+template <class... Args>
+struct EventRecordingFormat {
+    using Layout = ArgumentLayout<Args...>;
+
+    static constexpr std::uint64_t Magic {0x45564e5452454331}; // "EVNTREC1"
+
+    struct FileHeader {
+        std::uint64_t magic;
+        std::uint64_t layout;
+        std::uint64_t recordBytes;
+        std::uint64_t reserved;
+    };
+
+    struct Record {
+        std::uint64_t time;   // Nanoseconds since the recording was created
+        std::uint32_t stream; // Order in which the recorded event was attached
+        std::uint32_t reserved;
+        std::uint64_t words[Layout::Words];
+    };
+};
+
+template <class Signature>
+class EventRecorder;
+
+template <class Signature>
+class EventReplayer;
+
+/**
+ * @brief Records every raise of the events it is attached to into a binary file that EventReplayer can raise again.
+ *        A raise costs a clock read and a copy of the arguments into a buffer allocated by Create; the buffer is
+ *        written to the file when it is full, by Flush, or when the recorder is destroyed.
+ *
+ *        Like Event, the recorder is not thread safe: attached events must not be raised from several threads at
+ *        the same time.
+ *
+ * @tparam Args Function arguments, trivially copyable
+ */
+template <class... Args>
+class EventRecorder<void(Args...)> {
+private:
+    using Format = EventRecordingFormat<Args...>;
+    using Layout = typename Format::Layout;
+    using Record = typename Format::Record;
+
+    std::FILE* file {nullptr};
+    std::unique_ptr<Record[]> buffer;
+    std::size_t bufferRecords {0};
+    std::size_t buffered {0};
+    std::size_t recorded {0};
+    std::uint32_t streams {0};
+    std::chrono::steady_clock::time_point start;
+    ConnectionGroup connections;
+
+    void Write(std::uint32_t stream, const std::decay_t<Args>&... args) {
+        if (!file) {
+            return;
+        }
+        typename Layout::Payload payload {};
+        Layout::Write(payload, args...);
+        Record& record {buffer[buffered]};
+        record.time = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        record.stream = stream;
+        record.reserved = 0;
+        std::memcpy(record.words, payload.words, sizeof(record.words));
+        ++recorded;
+        if (++buffered == bufferRecords) {
+            Flush();
+        }
+    }
+
+public:
+    EventRecorder() = default;
+
+    //* Attached events hold a pointer to the recorder, it can't be copied or moved
+    EventRecorder(const EventRecorder&) = delete;
+    EventRecorder& operator=(const EventRecorder&) = delete;
+
+    //* Detaches from the events and writes what is left in the buffer
+    ~EventRecorder() {
+        connections.DisconnectAll();
+        Close();
+    }
+
+    /**
+     * @brief Creates the file, replacing any file at the path, and allocates the buffer. Timestamps start now.
+     *
+     * @param path File to record into
+     * @param bufferRecords Raises buffered before they are written
+     * @return false if the file couldn't be created
+     */
+    bool Create(const std::string& path, std::size_t bufferRecords = 4096) {
+        Close();
+        file = std::fopen(path.c_str(), "wb");
+        if (!file) {
+            return false;
+        }
+        std::setvbuf(file, nullptr, _IONBF, 0); // Records are already buffered
+        typename Format::FileHeader header {Format::Magic, Layout::Key(), sizeof(Record), 0};
+        if (std::fwrite(&header, sizeof(header), 1, file) != 1) {
+            std::fclose(file);
+            file = nullptr;
+            return false;
+        }
+        this->bufferRecords = bufferRecords == 0 ? 1 : bufferRecords;
+        buffer.reset(new Record[this->bufferRecords]);
+        buffered = 0;
+        recorded = 0;
+        start = std::chrono::steady_clock::now();
+        return true;
+    }
+
+    /**
+     * @brief Records every raise of the event, until the recorder is destroyed or the connection disconnected
+     *
+     * @param event Event to record
+     * @param priority Order of the recorder among the subscribers of the event
+     * @return Connection to stop recording the event
+     */
+    template <class Policy>
+    Connection Attach(Event<void(Args...), Policy>& event, int priority = 0) {
+        std::uint32_t stream {streams++};
+        Connection connection {event.Subscribe([this, stream](const std::decay_t<Args>&... args) { Write(stream, args...); },
+                                               priority)};
+        connections.Add(connection);
+        return connection;
+    }
+
+    /**
+     * @brief Writes the buffered raises to the file
+     *
+     * @return false if the file couldn't be written, the buffered raises are lost
+     */
+    bool Flush() {
+        if (!file) {
+            return false;
+        }
+        bool written {buffered == 0 || std::fwrite(buffer.get(), sizeof(Record), buffered, file) == buffered};
+        buffered = 0;
+        return written;
+    }
+
+    /**
+     * @brief Flushes and closes the file. Raises of the attached events are ignored until the next Create.
+     */
+    void Close() {
+        if (file) {
+            Flush();
+            std::fclose(file);
+            file = nullptr;
+        }
+    }
+
+    /**
+     * @brief Number of raises recorded since Create, written or still buffered
+     */
+    std::size_t Recorded() const {
+        return recorded;
+    }
+
+    bool IsOpen() const {
+        return file != nullptr;
+    }
+};
+
+/**
+ * @brief Maps a file written by EventRecorder and raises the recorded events again in the order they were recorded,
+ *        either as fast as possible or at the pace they were raised. Each attached event of the recorder is a
+ *        stream, numbered in the order of the Attach calls, and Target chooses the event raised for it.
+ *
+ * @tparam Args Function arguments, trivially copyable
+ */
+template <class... Args>
+class EventReplayer<void(Args...)> {
+private:
+    using Format = EventRecordingFormat<Args...>;
+    using Layout = typename Format::Layout;
+    using Record = typename Format::Record;
+    using Payload = typename Layout::Payload;
+
+    //* Type erased Event<void(Args...), Policy>
+    struct Stream {
+        void* event;
+        void (*invoke)(void* event, Payload& payload);
+    };
+
+    template <class Policy>
+    static void InvokeTarget(void* event, Payload& payload) {
+        Layout::Apply(payload, [event](Args&&... args) {
+            static_cast<Event<void(Args...), Policy>*>(event)->Invoke(static_cast<Args&&>(args)...);
+        });
+    }
+
+    void* memory {nullptr};
+    std::size_t mappedBytes {0};
+    const Record* records {nullptr};
+    std::size_t count {0};
+    std::vector<Stream> targets; // Indexed by stream
+
+    void Raise(const Record& record) {
+        if (record.stream < targets.size() && targets[record.stream].event) {
+            Payload payload;
+            std::memcpy(payload.words, record.words, sizeof(record.words));
+            targets[record.stream].invoke(targets[record.stream].event, payload);
+        }
+    }
+
+public:
+    EventReplayer() = default;
+
+    EventReplayer(const EventReplayer&) = delete;
+    EventReplayer& operator=(const EventReplayer&) = delete;
+
+    ~EventReplayer() {
+        Close();
+    }
+
+    /**
+     * @brief Maps the recording
+     *
+     * @param path File written by EventRecorder
+     * @return false if the file couldn't be mapped or was recorded for other arguments
+     */
+    bool Open(const std::string& path) {
+        Close();
+        int file {open(path.c_str(), O_RDONLY)};
+        if (file < 0) {
+            return false;
+        }
+        struct stat status {};
+        if (fstat(file, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(typename Format::FileHeader)) {
+            close(file);
+            return false;
+        }
+        std::size_t bytes {static_cast<std::size_t>(status.st_size)};
+        void* mapped {mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, file, 0)};
+        close(file);
+        if (mapped == MAP_FAILED) {
+            return false;
+        }
+
+        const auto& header {*static_cast<const typename Format::FileHeader*>(mapped)};
+        if (header.magic != Format::Magic || header.layout != Layout::Key() || header.recordBytes != sizeof(Record)) {
+            munmap(mapped, bytes);
+            return false;
+        }
+        memory = mapped;
+        mappedBytes = bytes;
+        records = reinterpret_cast<const Record*>(static_cast<const unsigned char*>(mapped) + sizeof(header));
+        count = (bytes - sizeof(header)) / sizeof(Record); // A partly written last record is ignored
+        madvise(mapped, bytes, MADV_SEQUENTIAL);
+        return true;
+    }
+
+    void Close() {
+        if (memory) {
+            munmap(memory, mappedBytes);
+            memory = nullptr;
+            mappedBytes = 0;
+            records = nullptr;
+            count = 0;
+        }
+    }
+
+    /**
+     * @brief Chooses the event raised for the records of a stream. Streams without a target are skipped.
+     *
+     * @param stream Order in which the recorded event was attached to the recorder, starting at 0
+     * @param event Event to raise, usually the recorded one
+     */
+    template <class Policy>
+    void Target(std::size_t stream, Event<void(Args...), Policy>& event) {
+        if (targets.size() <= stream) {
+            targets.resize(stream + 1, {nullptr, nullptr});
+        }
+        targets[stream] = {&event, &InvokeTarget<Policy>};
+    }
+
+    /**
+     * @brief Raises every recorded event in order, without waiting between them
+     *
+     * @return Number of records replayed
+     */
+    std::size_t Replay() {
+        for (std::size_t i = 0; i < count; ++i) {
+            Raise(records[i]);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Raises every recorded event in order, waiting between them as long as when they were recorded
+     *
+     * @param speed How many times faster than recorded, e.g. 2 halves the waits. 0 or less replays without waiting,
+     *              as Replay() does.
+     * @return Number of records replayed
+     */
+    std::size_t ReplayPaced(double speed = 1.0) {
+        if (!(speed > 0.0)) {
+            return Replay();
+        }
+        auto begin {std::chrono::steady_clock::now()};
+        for (std::size_t i = 0; i < count; ++i) {
+            std::chrono::duration<double, std::nano> offset {static_cast<double>(records[i].time) / speed};
+            std::this_thread::sleep_until(begin + std::chrono::duration_cast<std::chrono::steady_clock::duration>(offset));
+            Raise(records[i]);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Number of records in the file
+     */
+    std::size_t Size() const {
+        return count;
+    }
+
+    /**
+     * @brief Nanoseconds between the creation of the recording and the last record
+     */
+    std::uint64_t Duration() const {
+        return count == 0 ? 0 : records[count - 1].time;
+    }
+
+    bool IsOpen() const {
+        return memory != nullptr;
+    }
+};
+#endif // __EVENT_RECORDING_H__
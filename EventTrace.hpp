@@ -0,0 +1,388 @@
+#ifndef __EVENT_TRACE_H__
+#define __EVENT_TRACE_H__
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Instrumentation of Event, enabled per event with the TraceLogging policy, or for every event by defining
+ *        EVENT_TRACE before including Event.hpp. Other events record nothing.
+ *
+ *        Event records every subscribe, unsubscribe, invoke and handler call, with the time the calls took. Each
+ *        thread writes to its own ring buffer that keeps its last Capacity records, without locks. The buffers can
+ *        be exported from any thread as a Chrome trace (chrome://tracing, Perfetto), a binary file, or counters with
+ *        the latency percentiles of each subscriber.
+ *
+ *        Events with the LockFreeThreaded policy record their invokes but not the calls of each handler, since the
+ *        snapshot they call doesn't know the subscriptions its delegates belong to.
+ */
+class EventTrace {
+public:
+    enum class Type : std::uint32_t { Subscribe, Unsubscribe, Invoke, Handler };
+
+    struct Record {
+        std::uint64_t start;      // Nanoseconds since the first record of the program
+        std::uint64_t duration;   // Nanoseconds, 0 for Subscribe and Unsubscribe
+        std::uint64_t event;      // Address of the event
+        std::uint32_t slot;       // Subscription, as in its SubscriptionHandle. Unused by Invoke.
+        std::uint32_t generation;
+        std::uint32_t thread;     // Index of the recording thread, in order of their first record
+        Type type;
+    };
+
+    struct HandlerLatency {
+        std::uint64_t event;
+        std::uint32_t slot;
+        std::uint32_t generation;
+        std::string id;           // Id given to Subscribe, if any
+        std::uint64_t calls;      // Calls still in the buffers
+        std::uint64_t p50;        // Nanoseconds
+        std::uint64_t p99;
+    };
+
+    struct Counters {
+        std::uint64_t invokes {0};
+        std::uint64_t handlersCalled {0};
+        std::uint64_t overwritten {0};        // Records lost because a buffer was full
+        std::vector<HandlerLatency> handlers; // From the records still in the buffers, slowest p99 first
+    };
+
+    static constexpr std::size_t Capacity {1 << 16}; // Records kept per thread, a power of two
+
+private:
+    //* A record is stored as atomic words, so a thread exporting while others record never races with them. Release
+    //* stores and acquire loads are plain moves on x86 and ARM64 (stlr/ldar).
+    struct Entry {
+        std::atomic<std::uint64_t> words[5];
+    };
+
+    using SubscriberKey = std::tuple<std::uint64_t, std::uint32_t, std::uint32_t>; // Event, slot, generation
+    using SlotKey = std::pair<std::uint64_t, std::uint32_t>;                           // Event, slot
+
+    //* Id of the last named subscription of a slot made by a thread. A later subscription in the slot overwrites it,
+    //* so there is at most one per slot, and records of the unsubscribed one keep their name until then.
+    struct Name {
+        std::uint32_t generation;
+        std::string id;
+    };
+
+    //* Written only by its thread. claimed is advanced before writing an entry and head after it, so a reader can
+    //* tell which entries may have been overwritten while it was copying them. The ids are locked by their thread
+    //* and by exporters only, so subscribing doesn't wait for other threads.
+    struct Buffer {
+        std::uint32_t thread {0};
+        std::atomic<std::uint64_t> claimed {0};
+        std::atomic<std::uint64_t> head {0};
+        std::atomic<std::uint64_t> invokes {0};
+        std::atomic<std::uint64_t> handlersCalled {0};
+        std::unique_ptr<Entry[]> entries {new Entry[Capacity]()};
+        std::mutex idsMutex;
+        std::map<SlotKey, Name> ids;
+    };
+
+    //* Buffers are kept after their thread exits, so its records can still be exported. Only creating a buffer and
+    //* exporting lock the registry.
+    struct Registry {
+        std::mutex mutex;
+        std::vector<std::shared_ptr<Buffer>> buffers;
+    };
+
+    //* The ids given to Subscribe by every thread, gathered when exporting
+    static std::map<SubscriberKey, std::string> Ids(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+        std::map<SubscriberKey, std::string> ids;
+        for (auto& buffer : buffers) {
+            std::lock_guard<std::mutex> lock {buffer->idsMutex};
+            for (auto& [key, name] : buffer->ids) {
+                ids[{key.first, key.second, name.generation}] = name.id;
+            }
+        }
+        return ids;
+    }
+
+    //* Id of the subscription, empty if it had none or its slot was reused since
+    static std::string FindId(const std::map<SubscriberKey, std::string>& ids, std::uint64_t event, std::uint32_t slot,
+                              std::uint32_t generation) {
+        auto found {ids.find({event, slot, generation})};
+        return found != ids.end() ? found->second : std::string{};
+    }
+
+    static Registry& GetRegistry() {
+        static Registry registry;
+        return registry;
+    }
+
+    static Buffer& Local() {
+        thread_local std::shared_ptr<Buffer> buffer {[] {
+            Registry& registry {GetRegistry()};
+            std::lock_guard<std::mutex> lock {registry.mutex};
+            auto created {std::make_shared<Buffer>()};
+            created->thread = static_cast<std::uint32_t>(registry.buffers.size());
+            registry.buffers.push_back(created);
+            return created;
+        }()};
+        return *buffer;
+    }
+
+    static void Increment(std::atomic<std::uint64_t>& counter) {
+        // Only the owning thread writes, so this doesn't need a read-modify-write
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    static void Push(Buffer& buffer, Type type, const void* event, std::uint32_t slot, std::uint32_t generation,
+                     std::uint64_t start, std::uint64_t duration) {
+        std::uint64_t index {buffer.head.load(std::memory_order_relaxed)};
+        buffer.claimed.store(index + 1, std::memory_order_relaxed);
+        // A reader that sees any of these words also sees claimed, and knows the entry may be torn
+        Entry& entry {buffer.entries[index & (Capacity - 1)]};
+        entry.words[0].store(start, std::memory_order_release);
+        entry.words[1].store(duration, std::memory_order_release);
+        entry.words[2].store(reinterpret_cast<std::uintptr_t>(event), std::memory_order_release);
+        entry.words[3].store(slot | (static_cast<std::uint64_t>(generation) << 32), std::memory_order_release);
+        entry.words[4].store(static_cast<std::uint64_t>(type), std::memory_order_release);
+        buffer.head.store(index + 1, std::memory_order_release);
+    }
+
+    //* Copies the complete records of a buffer, dropping the ones that were overwritten while copying
+    static void Copy(const Buffer& buffer, std::vector<Record>& records) {
+        std::uint64_t end {buffer.head.load(std::memory_order_acquire)};
+        std::uint64_t begin {end > Capacity ? end - Capacity : 0};
+        std::size_t first {records.size()};
+        for (std::uint64_t i = begin; i < end; ++i) {
+            const Entry& entry {buffer.entries[i & (Capacity - 1)]};
+            std::uint64_t subscriber {entry.words[3].load(std::memory_order_acquire)};
+            records.push_back({entry.words[0].load(std::memory_order_acquire), entry.words[1].load(std::memory_order_acquire),
+                               entry.words[2].load(std::memory_order_acquire), static_cast<std::uint32_t>(subscriber),
+                               static_cast<std::uint32_t>(subscriber >> 32), buffer.thread,
+                               static_cast<Type>(entry.words[4].load(std::memory_order_acquire))});
+        }
+        std::uint64_t claimed {buffer.claimed.load(std::memory_order_relaxed)};
+        std::uint64_t valid {claimed > Capacity ? claimed - Capacity : 0};
+        if (valid > begin) {
+            std::size_t torn {static_cast<std::size_t>(std::min(valid, end) - begin)};
+            records.erase(records.begin() + static_cast<std::ptrdiff_t>(first),
+                          records.begin() + static_cast<std::ptrdiff_t>(first + torn));
+        }
+    }
+
+    static std::vector<std::shared_ptr<Buffer>> Buffers() {
+        Registry& registry {GetRegistry()};
+        std::lock_guard<std::mutex> lock {registry.mutex};
+        return registry.buffers;
+    }
+
+public:
+    static std::uint64_t Now() {
+        static const auto epoch {std::chrono::steady_clock::now()};
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count());
+    }
+
+    //* Hooks called by Event
+
+    static void Subscribed(const void* event, std::uint32_t slot, std::uint32_t generation, const char* id, std::size_t idSize) {
+        Buffer& buffer {Local()};
+        if (idSize > 0) {
+            std::lock_guard<std::mutex> lock {buffer.idsMutex};
+            Name& name {buffer.ids[{reinterpret_cast<std::uintptr_t>(event), slot}]};
+            name.generation = generation;
+            name.id.assign(id, idSize);
+        }
+        Push(buffer, Type::Subscribe, event, slot, generation, Now(), 0);
+    }
+
+    static void Unsubscribed(const void* event, std::uint32_t slot, std::uint32_t generation) {
+        Push(Local(), Type::Unsubscribe, event, slot, generation, Now(), 0);
+    }
+
+    //* Records an Invoke, or a Flush, when it ends
+    class InvokeScope {
+    private:
+        const void* event;
+        std::uint64_t start {Now()};
+
+    public:
+        explicit InvokeScope(const void* event) : event{event} {}
+        InvokeScope(const InvokeScope&) = delete;
+        InvokeScope& operator=(const InvokeScope&) = delete;
+
+        ~InvokeScope() {
+            Buffer& buffer {Local()};
+            Increment(buffer.invokes);
+            Push(buffer, Type::Invoke, event, 0, 0, start, Now() - start);
+        }
+    };
+
+    //* Records the call of one subscriber when it returns
+    class HandlerScope {
+    private:
+        const void* event;
+        std::uint32_t slot;
+        std::uint32_t generation;
+        std::uint64_t start {Now()};
+
+    public:
+        HandlerScope(const void* event, std::uint32_t slot, std::uint32_t generation)
+            : event{event}, slot{slot}, generation{generation} {}
+        HandlerScope(const HandlerScope&) = delete;
+        HandlerScope& operator=(const HandlerScope&) = delete;
+
+        ~HandlerScope() {
+            Buffer& buffer {Local()};
+            Increment(buffer.handlersCalled);
+            Push(buffer, Type::Handler, event, slot, generation, start, Now() - start);
+        }
+    };
+
+    //* Exporters. They can run while other threads record, records overwritten meanwhile are left out.
+
+    /**
+     * @brief Records of every thread still in the buffers, sorted by start time
+     */
+    static std::vector<Record> Snapshot() {
+        std::vector<Record> records;
+        for (auto& buffer : Buffers()) {
+            Copy(*buffer, records);
+        }
+        std::sort(records.begin(), records.end(), [](const Record& lhs, const Record& rhs) {
+            return lhs.start < rhs.start;
+        });
+        return records;
+    }
+
+    /**
+     * @brief Totals since the program started and latency percentiles of each subscriber
+     */
+    static Counters Statistics() {
+        Counters counters;
+        for (auto& buffer : Buffers()) {
+            counters.invokes += buffer->invokes.load(std::memory_order_relaxed);
+            counters.handlersCalled += buffer->handlersCalled.load(std::memory_order_relaxed);
+            std::uint64_t head {buffer->head.load(std::memory_order_relaxed)};
+            counters.overwritten += head > Capacity ? head - Capacity : 0;
+        }
+
+        std::map<SubscriberKey, std::vector<std::uint64_t>> durations;
+        for (auto& record : Snapshot()) {
+            if (record.type == Type::Handler) {
+                durations[{record.event, record.slot, record.generation}].push_back(record.duration);
+            }
+        }
+
+        std::map<SubscriberKey, std::string> ids {Ids(Buffers())};
+        for (auto& [key, times] : durations) {
+            std::sort(times.begin(), times.end());
+            counters.handlers.push_back({std::get<0>(key), std::get<1>(key), std::get<2>(key),
+                                         FindId(ids, std::get<0>(key), std::get<1>(key), std::get<2>(key)), times.size(),
+                                         times[(times.size() - 1) / 2], times[(times.size() - 1) * 99 / 100]});
+        }
+        std::sort(counters.handlers.begin(), counters.handlers.end(), [](const HandlerLatency& lhs, const HandlerLatency& rhs) {
+            return lhs.p99 > rhs.p99;
+        });
+        return counters;
+    }
+
+    /**
+     * @brief Writes the records in the Chrome trace event format, which chrome://tracing and Perfetto open
+     *
+     * @return false if the file couldn't be written
+     */
+    static bool WriteChromeTrace(const std::string& path) {
+        std::FILE* file {std::fopen(path.c_str(), "w")};
+        if (!file) {
+            return false;
+        }
+        std::map<SubscriberKey, std::string> ids {Ids(Buffers())};
+
+        std::fputs("{\"traceEvents\":[\n", file);
+        bool first {true};
+        for (auto& record : Snapshot()) {
+            std::fputs(first ? "" : ",\n", file);
+            first = false;
+            double start {static_cast<double>(record.start) / 1000.0};
+            double duration {static_cast<double>(record.duration) / 1000.0};
+            if (record.type == Type::Invoke) {
+                std::fprintf(file, "{\"name\":\"Invoke\",\"cat\":\"event\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u,"
+                                   "\"args\":{\"event\":\"0x%llx\"}}",
+                             start, duration, record.thread, static_cast<unsigned long long>(record.event));
+                continue;
+            }
+
+            std::string name {FindId(ids, record.event, record.slot, record.generation)};
+            if (!name.empty()) {
+                // Ids are written as they are, only the characters that would break the JSON string are replaced
+                std::replace_if(name.begin(), name.end(), [](char c) {
+                    return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+                }, '_');
+            } else {
+                name = "#" + std::to_string(record.slot);
+            }
+            const char* type {record.type == Type::Handler ? "" : record.type == Type::Subscribe ? "Subscribe " : "Unsubscribe "};
+            std::fprintf(file, "{\"name\":\"%s%s\",\"cat\":\"event\",\"ph\":\"%s\",\"ts\":%.3f,", type, name.c_str(),
+                         record.type == Type::Handler ? "X" : "i", start);
+            if (record.type == Type::Handler) {
+                std::fprintf(file, "\"dur\":%.3f,", duration);
+            } else {
+                std::fputs("\"s\":\"t\",", file);
+            }
+            std::fprintf(file, "\"pid\":1,\"tid\":%u,\"args\":{\"event\":\"0x%llx\",\"slot\":%u,\"generation\":%u}}", record.thread,
+                         static_cast<unsigned long long>(record.event), record.slot, record.generation);
+        }
+        std::fputs("\n]}\n", file);
+        return std::fclose(file) == 0;
+    }
+
+    /**
+     * @brief Writes the records in a compact binary file: the 8 bytes "EVTRACE1", the record size as uint32 and the
+     *        record count as uint64, then the Record structs as they are in memory, all in the byte order of the machine
+     *
+     * @return false if the file couldn't be written
+     */
+    static bool WriteBinary(const std::string& path) {
+        std::FILE* file {std::fopen(path.c_str(), "wb")};
+        if (!file) {
+            return false;
+        }
+        std::vector<Record> records {Snapshot()};
+        std::uint32_t recordSize {sizeof(Record)};
+        std::uint64_t count {records.size()};
+        bool written {std::fwrite("EVTRACE1", 1, 8, file) == 8 && std::fwrite(&recordSize, sizeof(recordSize), 1, file) == 1 &&
+                      std::fwrite(&count, sizeof(count), 1, file) == 1 &&
+                      std::fwrite(records.data(), sizeof(Record), records.size(), file) == records.size()};
+        return std::fclose(file) == 0 && written;
+    }
+};
+
+/**
+ * @brief Logging policy of Event recording in the EventTrace buffers, e.g. Event<void(int), EventPolicy<TraceLogging>>.
+ *        The default logging policy when EVENT_TRACE is defined.
+ */
+struct TraceLogging {
+    static constexpr bool TimesHandlers {true};
+
+    template <class Message>
+    static void Log(Message&&) {}
+
+    static void Subscribed(const void* event, std::uint32_t slot, std::uint32_t generation, const std::string& id) {
+        EventTrace::Subscribed(event, slot, generation, id.data(), id.size());
+    }
+
+    static void Unsubscribed(const void* event, std::uint32_t slot, std::uint32_t generation) {
+        EventTrace::Unsubscribed(event, slot, generation);
+    }
+
+    using InvokeScope = EventTrace::InvokeScope;
+    using HandlerScope = EventTrace::HandlerScope;
+};
+
+#endif // __EVENT_TRACE_H__
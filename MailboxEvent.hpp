@@ -0,0 +1,222 @@
+#ifndef __MAILBOX_EVENT_H__
+#define __MAILBOX_EVENT_H__
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Event.hpp"
+
+/**
+ * @brief What Post does when the mailbox is full
+ */
+enum class MailboxOverflow {
+    Block,      // Waits for Pump to make room
+    DropOldest, // Discards the oldest posted arguments to make room
+    DropNewest  // Discards the arguments being posted
+};
+
+template <class Signature, class Policy = EventPolicy<>>
+class MailboxEvent;
+
+/**
+ * @brief Event owned by one thread that any thread can raise: Post copies the arguments into a bounded lock-free
+ *        ring, and Pump, called by the owner thread, raises the event once for each of them in the order they were
+ *        posted. Subscribers are the same as in Event and are only called from Pump or Invoke, on the owner thread,
+ *        so neither they nor the event need to be thread safe.
+ *
+ *        The ring is allocated by the constructor, Post and Pump don't allocate.
+ *
+ * @tparam R Return type
+ * @tparam Args Function arguments
+ * @tparam Policy See EventPolicy
+ */
+template <class R, class... Args, class Policy>
+class MailboxEvent<R(Args...), Policy> : public Event<R(Args...), Policy> {
+public:
+    //* What a cell of the ring holds: a copy of the posted arguments, references included
+    using Arguments = std::tuple<std::decay_t<Args>...>;
+
+private:
+    static constexpr std::size_t CacheLine {64};
+
+    //* A cell is free for the producer of position p when sequence == p, and holds its arguments when sequence == p + 1
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        alignas(Arguments) unsigned char storage[sizeof(Arguments)];
+
+        Arguments& Values() {
+            return *std::launder(reinterpret_cast<Arguments*>(storage));
+        }
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    std::size_t mask;
+    MailboxOverflow overflow;
+    // Written by different threads, kept on their own cache lines
+    alignas(CacheLine) std::atomic<std::size_t> enqueuePosition {0};
+    alignas(CacheLine) std::atomic<std::size_t> dequeuePosition {0};
+    alignas(CacheLine) std::atomic<std::size_t> dropped {0};
+
+    static std::size_t RoundCapacity(std::size_t capacity) {
+        std::size_t rounded {2};
+        while (rounded < capacity) {
+            rounded *= 2;
+        }
+        return rounded;
+    }
+
+    //* Fails when the ring is full
+    bool TryPush(Arguments& values) {
+        std::size_t position {enqueuePosition.load(std::memory_order_relaxed)};
+        for (;;) {
+            Cell& cell {cells[position & mask]};
+            std::size_t sequence {cell.sequence.load(std::memory_order_acquire)};
+            auto difference {static_cast<std::ptrdiff_t>(sequence - position)};
+            if (difference == 0) {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    ::new (cell.storage) Arguments(std::move(values));
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    //* Moves the oldest arguments out of the ring and hands them to take once their cell is free again. Fails when
+    //* the ring is empty or the oldest arguments are still being written. Producers dropping the oldest arguments
+    //* pop too, so the position is claimed with a CAS as well.
+    template <class Take>
+    bool TryPop(Take&& take) {
+        std::size_t position {dequeuePosition.load(std::memory_order_relaxed)};
+        for (;;) {
+            Cell& cell {cells[position & mask]};
+            std::size_t sequence {cell.sequence.load(std::memory_order_acquire)};
+            auto difference {static_cast<std::ptrdiff_t>(sequence - (position + 1))};
+            if (difference == 0) {
+                if (dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    Arguments values {std::move(cell.Values())};
+                    cell.Values().~Arguments();
+                    cell.sequence.store(position + mask + 1, std::memory_order_release);
+                    take(values);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    //* The mailbox owns the values, so the last subscriber can take them
+    template <std::size_t... Index>
+    void Raise(Arguments& values, std::index_sequence<Index...>) {
+        this->InvokeMoveLast(static_cast<Args&&>(std::get<Index>(values))...);
+    }
+
+public:
+    /**
+     * @brief Allocates the ring
+     *
+     * @param capacity Arguments the ring can hold, rounded up to a power of two
+     * @param overflow What Post does when the ring is full
+     */
+    explicit MailboxEvent(std::size_t capacity = 1024, MailboxOverflow overflow = MailboxOverflow::Block)
+        : cells{new Cell[RoundCapacity(capacity)]}, mask{RoundCapacity(capacity) - 1}, overflow{overflow} {
+        for (std::size_t i = 0; i <= mask; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    //* Producers hold on to the mailbox, it can't be copied or moved
+    MailboxEvent(const MailboxEvent&) = delete;
+    MailboxEvent& operator=(const MailboxEvent&) = delete;
+
+    //* Destroys the arguments that were never pumped. No thread may still be posting.
+    ~MailboxEvent() {
+        while (TryPop([](Arguments&) {})) {
+        }
+    }
+
+    /**
+     * @brief Stores a copy of the arguments for the next Pump. Can be called from any thread.
+     *        With MailboxOverflow::Block and a full ring it waits for the owner thread to Pump, so the owner thread
+     *        itself (e.g. a handler) must not post to a full blocking mailbox.
+     *
+     * @param args
+     * @return false if the arguments were dropped because the ring was full (MailboxOverflow::DropNewest)
+     */
+    template <class... T>
+    bool Post(T&&... args) {
+        Arguments values {std::forward<T>(args)...};
+        while (!TryPush(values)) {
+            switch (overflow) {
+            case MailboxOverflow::Block:
+                std::this_thread::yield();
+                break;
+            case MailboxOverflow::DropOldest:
+                if (TryPop([](Arguments&) {})) {
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+                break;
+            case MailboxOverflow::DropNewest:
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Raises the event for each set of arguments posted before the call, oldest first, through
+     *        InvokeMoveLast: the last subscriber takes the mailbox copy. Must be called by the owner thread.
+     *        Arguments posted while pumping, by the handlers or other threads, wait for the next Pump.
+     *
+     * @return Number of times the event was raised
+     */
+    std::size_t Pump() {
+        std::size_t first {dequeuePosition.load(std::memory_order_relaxed)};
+        std::size_t available {enqueuePosition.load(std::memory_order_acquire) - first};
+        std::size_t raised {0};
+        while (raised < available &&
+               TryPop([this](Arguments& values) { Raise(values, std::index_sequence_for<Args...>{}); })) {
+            ++raised;
+        }
+        return raised;
+    }
+
+    /**
+     * @brief Number of posted arguments waiting for Pump. Only a snapshot while other threads post.
+     */
+    std::size_t Pending() const {
+        std::size_t first {dequeuePosition.load(std::memory_order_acquire)};
+        return enqueuePosition.load(std::memory_order_acquire) - first;
+    }
+
+    /**
+     * @brief Number of arguments the ring holds
+     */
+    std::size_t Capacity() const {
+        return mask + 1;
+    }
+
+    /**
+     * @brief Arguments discarded because the ring was full, since the mailbox was created
+     */
+    std::size_t Dropped() const {
+        return dropped.load(std::memory_order_relaxed);
+    }
+};
+#endif // __MAILBOX_EVENT_H__
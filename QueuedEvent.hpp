@@ -0,0 +1,128 @@
+#ifndef __QUEUED_EVENT_H__
+#define __QUEUED_EVENT_H__
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Event.hpp"
+
+/**
+ * @brief Event that can also be raised in deferred mode: Enqueue stores the arguments and Flush calls every
+ *        subscriber over the whole batch, one subscriber at a time, instead of interleaving handlers with the
+ *        code raising the event. Subscribers are the same as in Event, and Invoke still calls them right away.
+ *        
+ *        The queue buffers are reused, so once they have grown to the usual batch size Enqueue doesn't allocate.
+ *        Enqueue and Flush lock the event as its threading policy requires, so with MutexThreaded other threads can
+ *        enqueue while one thread flushes; they wait for the flush to finish.
+ * 
+ * @tparam R Return type
+ * @tparam Args Function arguments
+ * @tparam Policy See EventPolicy
+ */
+template <class R, class... Args, class Policy>
+class QueuedEvent<R(Args...), Policy> : public Event<R(Args...), Policy> {
+    static_assert(!(std::is_rvalue_reference_v<Args> || ...),
+                  "A queued argument is shared by all the subscribers, it can't be passed as an rvalue reference");
+
+public:
+    using Arguments = std::tuple<std::decay_t<Args>...>;
+    //* What batch handlers receive: the arguments of every queued raise, in order
+    using Batch = Span<const Arguments>;
+
+private:
+    using Base = Event<R(Args...), Policy>;
+
+    std::vector<Arguments> queue;
+    std::vector<Arguments> flushing; // Swapped with queue in Flush, so handlers can enqueue for the next flush
+    Event<void(Batch), Policy> batchListeners;
+
+    template <std::size_t... Index>
+    static void Call(const typename Base::DelegateType& func, Arguments& args, std::index_sequence<Index...>) {
+        func.CallShared(std::get<Index>(args)...);
+    }
+
+public:
+    QueuedEvent() = default;
+
+    /**
+     * @brief Stores the arguments to call the subscribers with on the next Flush
+     * 
+     * @param args 
+     */
+    template <class... T>
+    void Enqueue(T&&... args) {
+        typename Base::LockScope lock {*this};
+        queue.emplace_back(std::forward<T>(args)...);
+    }
+
+    /**
+     * @brief Calls each subscriber with every queued set of arguments, then each batch handler once with all of them.
+     *        Raises enqueued by the handlers are kept for the next Flush. A Flush called by a handler while
+     *        flushing does nothing, so raises are never delivered twice.
+     */
+    void Flush() {
+        typename Base::LockScope lock {*this};
+        // flushing is only empty between two flushes
+        if (queue.empty() || !flushing.empty()) {
+            return;
+        }
+        std::swap(queue, flushing);
+
+        Base::Logging::Log([&](auto& out) { out << "\n>> Flushing " << flushing.size() << " queued calls...\n\n"; });
+        typename Base::Logging::InvokeScope trace {this};
+        typename Base::DispatchScope scope {*this};
+        for (auto& func : this->delegates) {
+            if (!func) {
+                continue;
+            }
+            for (auto& args : flushing) {
+                if (!func) {
+                    break; // Unsubscribed by one of its calls
+                }
+                auto handlerTrace {this->TraceHandler(func)};
+                Call(func, args, std::index_sequence_for<Args...>{});
+            }
+        }
+        batchListeners.Invoke(Batch{flushing.data(), flushing.size()});
+
+        flushing.clear();
+    }
+
+    /**
+     * @brief Number of raises waiting for the next Flush
+     */
+    std::size_t Pending() const {
+        typename Base::LockScope lock {*this};
+        return queue.size();
+    }
+
+    /**
+     * @brief Subscribes a handler that receives the whole batch on Flush, as void(QueuedEvent::Batch).
+     *        Takes the same arguments as Event::Subscribe. Batch handlers are not called by Invoke.
+     * 
+     * @return Connection to unsubscribe the handler, or UnsubscribeBatch
+     */
+    template <class... T>
+    Connection SubscribeBatch(T&&... args) {
+        return batchListeners.Subscribe(std::forward<T>(args)...);
+    }
+
+    /**
+     * @brief Unsubscribes a batch handler. Takes the same arguments as Event::Unsubscribe.
+     */
+    template <class... T>
+    void UnsubscribeBatch(T&&... args) {
+        batchListeners.Unsubscribe(std::forward<T>(args)...);
+    }
+
+    /**
+     * @brief Unsubscribes all batch handlers owned by the invoker instance
+     */
+    template <class Invoker>
+    void RemoveBatchListener(Invoker* invoker) {
+        batchListeners.RemoveListener(invoker);
+    }
+};
+#endif // __QUEUED_EVENT_H__
@@ -0,0 +1,384 @@
+#ifndef __SHARED_EVENT_CHANNEL_H__
+#define __SHARED_EVENT_CHANNEL_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ArgumentLayout.hpp"
+#include "Event.hpp"
+
+/**
+ * @brief Shared memory ring used by SharedEventPublisher and SharedEventMirror, one writer and any number of
+ *        readers, in the same or other processes of the host (POSIX shared memory).
+ *        The writer never waits for the readers: once a reader falls a whole ring behind, the oldest raises are
+ *        overwritten and the reader counts them as missed. Each slot is a seqlock: the sequence is odd while the
+ *        slot is written, and the arguments are stored as relaxed atomic words, so a reader racing the writer sees
+ *        a changed sequence and drops the copy it made.
+ *
+ * @tparam Args Arguments of the event, trivially copyable
+ */
+template <class... Args>
+class SharedEventRing {
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Shared memory needs lock-free 64 bit atomics");
+
+protected:
+    static constexpr std::uint64_t Magic {0x45564e5443484e31}; // "EVNTCHN1"
+    static constexpr std::size_t CacheLine {64};
+
+    using Layout = ArgumentLayout<Args...>;
+    using Payload = typename Layout::Payload;
+    static constexpr std::size_t Words {Layout::Words};
+
+    struct RingHeader {
+        std::atomic<std::uint64_t> magic;    // Stored last by the publisher, once the rest is initialized
+        std::uint64_t layout;
+        std::uint64_t capacity;
+        std::atomic<std::uint64_t> closed;   // Set when the publisher is destroyed
+        alignas(CacheLine) std::atomic<std::uint64_t> writePosition;
+    };
+
+    //* sequence is 2 * position + 2 once the raise at position is complete
+    struct RingSlot {
+        std::atomic<std::uint64_t> sequence;
+        std::atomic<std::uint64_t> words[Words];
+    };
+
+    RingHeader* channel {nullptr};
+    RingSlot* ringSlots {nullptr};
+    std::size_t mappedBytes {0};
+    std::uint64_t ringMask {0};
+
+    static std::size_t MappedBytes(std::uint64_t capacity) {
+        return sizeof(RingHeader) + sizeof(RingSlot) * capacity;
+    }
+
+    bool Map(int file, std::size_t bytes, bool writable) {
+        void* memory {mmap(nullptr, bytes, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, file, 0)};
+        close(file);
+        if (memory == MAP_FAILED) {
+            return false;
+        }
+        channel = static_cast<RingHeader*>(memory);
+        ringSlots = reinterpret_cast<RingSlot*>(static_cast<unsigned char*>(memory) + sizeof(RingHeader));
+        mappedBytes = bytes;
+        return true;
+    }
+
+    void Unmap() {
+        if (channel) {
+            munmap(channel, mappedBytes);
+            channel = nullptr;
+            ringSlots = nullptr;
+            mappedBytes = 0;
+        }
+    }
+
+    SharedEventRing() = default;
+
+    ~SharedEventRing() {
+        Unmap();
+    }
+
+public:
+    SharedEventRing(const SharedEventRing&) = delete;
+    SharedEventRing& operator=(const SharedEventRing&) = delete;
+
+    /**
+     * @brief Checks if the channel is mapped
+     */
+    bool IsOpen() const {
+        return channel != nullptr;
+    }
+
+    /**
+     * @brief Number of raises the ring holds
+     */
+    std::size_t Capacity() const {
+        return static_cast<std::size_t>(ringMask + 1);
+    }
+
+    /**
+     * @brief Removes the shared memory name. Processes that mapped the channel keep using it, the next Create
+     *        starts a new one.
+     *
+     * @param name Shared memory name, e.g. "/game.onDamage"
+     * @return false if there was no channel with that name
+     */
+    static bool Remove(const std::string& name) {
+        return shm_unlink(name.c_str()) == 0;
+    }
+};
+
+template <class Signature>
+class SharedEventPublisher;
+
+template <class Signature, class Policy = EventPolicy<>>
+class SharedEventMirror;
+
+/**
+ * @brief Writing side of a shared memory event channel: every raise of the events it is attached to is copied into
+ *        the ring, without system calls, and raised again by the SharedEventMirror objects of other processes on
+ *        their next Poll. Local subscribers of the events are called as usual.
+ *
+ *        There must be only one publisher per channel, attached events must not be raised from several threads at
+ *        the same time.
+ *
+ * @tparam Args Function arguments, trivially copyable
+ */
+template <class... Args>
+class SharedEventPublisher<void(Args...)> : public SharedEventRing<Args...> {
+private:
+    using Ring = SharedEventRing<Args...>;
+    using typename Ring::RingHeader;
+    using typename Ring::Payload;
+    using typename Ring::RingSlot;
+
+    std::uint64_t position {0};
+    ConnectionGroup connections;
+
+    //* Tells the mirrors of a channel that is about to be replaced that it is closed
+    static void MarkClosed(int file, std::size_t size) {
+        if (size < sizeof(RingHeader)) {
+            return;
+        }
+        void* memory {mmap(nullptr, sizeof(RingHeader), PROT_READ | PROT_WRITE, MAP_SHARED, file, 0)};
+        if (memory == MAP_FAILED) {
+            return;
+        }
+        RingHeader& channel {*static_cast<RingHeader*>(memory)};
+        if (channel.magic.load(std::memory_order_acquire) == Ring::Magic) {
+            channel.closed.store(1, std::memory_order_release);
+        }
+        munmap(memory, sizeof(RingHeader));
+    }
+
+public:
+    SharedEventPublisher() = default;
+
+    //* Detaches from the events and tells the mirrors the channel is closed
+    ~SharedEventPublisher() {
+        connections.DisconnectAll();
+        if (this->channel) {
+            this->channel->closed.store(1, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Creates the shared memory of the channel, or reuses it if a previous publisher left a channel of the
+     *        same signature and capacity, so mirrors that are still open keep receiving. A channel of another
+     *        signature or capacity is never resized: its name is removed and a new one created, and the mirrors
+     *        that still map the old one see it Closed.
+     *
+     * @param name Shared memory name, e.g. "/game.onDamage"
+     * @param capacity Raises the ring holds, rounded up to a power of two
+     * @return false if the shared memory couldn't be created or mapped
+     */
+    bool Create(const std::string& name, std::size_t capacity = 4096) {
+        if (this->channel) {
+            this->channel->closed.store(1, std::memory_order_release);
+            this->Unmap();
+        }
+        std::uint64_t slots {2};
+        while (slots < capacity) {
+            slots *= 2;
+        }
+        std::size_t bytes {Ring::MappedBytes(slots)};
+
+        int file {shm_open(name.c_str(), O_RDWR, 0)};
+        if (file >= 0) {
+            struct stat status {};
+            std::size_t size {fstat(file, &status) == 0 ? static_cast<std::size_t>(status.st_size) : 0};
+            if (size == bytes && this->Map(file, bytes, true)) {
+                RingHeader& channel {*this->channel};
+                if (channel.magic.load(std::memory_order_acquire) == Ring::Magic &&
+                    channel.layout == Ring::Layout::Key() && channel.capacity == slots) {
+                    this->ringMask = slots - 1;
+                    position = channel.writePosition.load(std::memory_order_relaxed);
+                    channel.closed.store(0, std::memory_order_release);
+                    return true;
+                }
+                channel.closed.store(1, std::memory_order_release);
+                this->Unmap();
+            } else if (size != bytes) {
+                MarkClosed(file, size);
+                close(file);
+            }
+            shm_unlink(name.c_str());
+        }
+
+        // A new object, zero filled by ftruncate, that nobody else has mapped yet
+        file = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (file < 0) {
+            return false;
+        }
+        if (ftruncate(file, static_cast<off_t>(bytes)) != 0) {
+            close(file);
+            shm_unlink(name.c_str());
+            return false;
+        }
+        if (!this->Map(file, bytes, true)) {
+            shm_unlink(name.c_str());
+            return false;
+        }
+        this->ringMask = slots - 1;
+        position = 0;
+        RingHeader& channel {*this->channel};
+        channel.layout = Ring::Layout::Key();
+        channel.capacity = slots;
+        channel.magic.store(Ring::Magic, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Copies the arguments into the ring for the mirrors. Doesn't wait for them and makes no system call.
+     *
+     * @param args
+     */
+    void Publish(const std::decay_t<Args>&... args) {
+        if (!this->channel) {
+            return;
+        }
+        Payload payload {};
+        Ring::Layout::Write(payload, args...);
+
+        RingSlot& slot {this->ringSlots[position & this->ringMask]};
+        slot.sequence.store(2 * position + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0; i < Ring::Words; ++i) {
+            slot.words[i].store(payload.words[i], std::memory_order_relaxed);
+        }
+        slot.sequence.store(2 * position + 2, std::memory_order_release);
+        this->channel->writePosition.store(++position, std::memory_order_release);
+    }
+
+    /**
+     * @brief Publishes every raise of the event, until the publisher is destroyed or the connection disconnected
+     *
+     * @param event Event raised in this process
+     * @param priority Order of the publisher among the subscribers of the event
+     * @return Connection to stop publishing the event
+     */
+    template <class Policy>
+    Connection Attach(Event<void(Args...), Policy>& event, int priority = 0) {
+        Connection connection {event.template Subscribe<&SharedEventPublisher::Publish>(this, priority)};
+        connections.Add(connection);
+        return connection;
+    }
+};
+
+/**
+ * @brief Reading side of a shared memory event channel: an Event raised with the arguments published by the
+ *        SharedEventPublisher of another process, once per Poll. Local code can also subscribe and raise it as any
+ *        other Event. Polling reads the shared memory without system calls.
+ *
+ * @tparam Args Function arguments, trivially copyable
+ * @tparam Policy See EventPolicy
+ */
+template <class... Args, class Policy>
+class SharedEventMirror<void(Args...), Policy> : public Event<void(Args...), Policy>, public SharedEventRing<Args...> {
+private:
+    using Ring = SharedEventRing<Args...>;
+    using typename Ring::RingHeader;
+    using typename Ring::Payload;
+    using typename Ring::RingSlot;
+
+    std::uint64_t cursor {0};
+    std::size_t missed {0};
+
+public:
+    SharedEventMirror() = default;
+
+    /**
+     * @brief Maps the channel created by a publisher. Only raises published after Open are received.
+     *
+     * @param name Shared memory name given to SharedEventPublisher::Create
+     * @return false if there is no channel with that name yet, or it was created for other arguments
+     */
+    bool Open(const std::string& name) {
+        this->Unmap();
+        int file {shm_open(name.c_str(), O_RDONLY, 0)};
+        if (file < 0) {
+            return false;
+        }
+        struct stat status {};
+        if (fstat(file, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(RingHeader)) {
+            close(file);
+            return false;
+        }
+        std::size_t bytes {static_cast<std::size_t>(status.st_size)};
+        if (!this->Map(file, bytes, false)) {
+            return false;
+        }
+
+        RingHeader& channel {*this->channel};
+        if (channel.magic.load(std::memory_order_acquire) != Ring::Magic || channel.layout != Ring::Layout::Key() ||
+            Ring::MappedBytes(channel.capacity) != bytes) {
+            this->Unmap();
+            return false;
+        }
+        this->ringMask = channel.capacity - 1;
+        cursor = channel.writePosition.load(std::memory_order_acquire);
+        return true;
+    }
+
+    /**
+     * @brief Raises the event once for each raise published since the last Poll, oldest first
+     *
+     * @return Number of times the event was raised
+     */
+    std::size_t Poll() {
+        if (!this->channel) {
+            return 0;
+        }
+        std::uint64_t end {this->channel->writePosition.load(std::memory_order_acquire)};
+        if (end < cursor) {
+            cursor = end; // A new publisher reinitialized the channel
+        }
+        if (end - cursor > this->Capacity()) {
+            missed += static_cast<std::size_t>(end - cursor - this->Capacity());
+            cursor = end - this->Capacity();
+        }
+
+        std::size_t raised {0};
+        for (; cursor < end; ++cursor) {
+            RingSlot& slot {this->ringSlots[cursor & this->ringMask]};
+            std::uint64_t sequence {slot.sequence.load(std::memory_order_acquire)};
+            Payload payload;
+            for (std::size_t i = 0; i < Ring::Words; ++i) {
+                payload.words[i] = slot.words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence != 2 * cursor + 2 || slot.sequence.load(std::memory_order_relaxed) != sequence) {
+                ++missed; // Overwritten by the publisher while copying
+                continue;
+            }
+            Ring::Layout::Apply(payload, [this](Args&&... args) { this->Invoke(static_cast<Args&&>(args)...); });
+            ++raised;
+        }
+        return raised;
+    }
+
+    /**
+     * @brief Raises overwritten before this mirror could poll them, since Open
+     */
+    std::size_t Missed() const {
+        return missed;
+    }
+
+    /**
+     * @brief Checks if the publisher was destroyed or replaced the channel. A publisher created again with the same
+     *        name, signature and capacity reopens it, otherwise the mirror has to Open the new channel.
+     */
+    bool Closed() const {
+        return this->channel && this->channel->closed.load(std::memory_order_acquire) != 0;
+    }
+};
+#endif // __SHARED_EVENT_CHANNEL_H__
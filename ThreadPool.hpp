@@ -0,0 +1,175 @@
+#ifndef __THREAD_POOL_H__
+#define __THREAD_POOL_H__
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Event.hpp"
+
+/**
+ * @brief Work stealing thread pool used by Event::InvokeParallel by default.
+ *        Each worker has its own queue and takes work from the others when it runs out. The thread calling
+ *        ParallelFor also runs tasks until all of its tasks are done, so nested calls from a task don't deadlock.
+ */
+class ThreadPool : public EventExecutor {
+private:
+    //* Tasks started by one ParallelFor call
+    struct Batch {
+        const Delegate<void(std::size_t)>* task;
+        std::atomic<std::size_t> remaining;
+    };
+
+    struct Job {
+        Batch* batch;
+        std::size_t index;
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues; // One per worker
+    std::vector<std::thread> workers;
+    std::mutex sleepMutex;
+    std::condition_variable wakeUp;
+    std::atomic<std::size_t> queued {0};
+    std::atomic<std::size_t> nextQueue {0};
+    bool stopping {false}; // Guarded by sleepMutex
+
+    //* Takes the newest job of the own queue, or the oldest job of another one
+    bool TryTake(std::size_t own, Job& job) {
+        if (queues.empty()) {
+            return false;
+        }
+        if (own < queues.size()) {
+            Queue& queue {*queues[own]};
+            std::lock_guard<std::mutex> lock {queue.mutex};
+            if (!queue.jobs.empty()) {
+                job = queue.jobs.back();
+                queue.jobs.pop_back();
+                queued.fetch_sub(1);
+                return true;
+            }
+        }
+        std::size_t start {own < queues.size() ? own + 1 : nextQueue.load(std::memory_order_relaxed)};
+        for (std::size_t i = 0; i < queues.size(); ++i) {
+            Queue& queue {*queues[(start + i) % queues.size()]};
+            std::lock_guard<std::mutex> lock {queue.mutex};
+            if (!queue.jobs.empty()) {
+                job = queue.jobs.front();
+                queue.jobs.pop_front();
+                queued.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static void Run(const Job& job) {
+        (*job.batch->task)(job.index);
+        job.batch->remaining.fetch_sub(1, std::memory_order_release);
+    }
+
+    void WorkerLoop(std::size_t own) {
+        Job job;
+        while (true) {
+            if (TryTake(own, job)) {
+                Run(job);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock {sleepMutex};
+            wakeUp.wait(lock, [&] { return stopping || queued.load() > 0; });
+            if (stopping) {
+                return;
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Starts the workers. The thread calling ParallelFor also runs tasks, so threads - 1 workers
+     *        use all cores.
+     * 
+     * @param threads Number of worker threads
+     */
+    explicit ThreadPool(std::size_t threads) {
+        for (std::size_t i = 0; i < threads; ++i) {
+            queues.push_back(std::make_unique<Queue>());
+        }
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers.emplace_back([this, i] { WorkerLoop(i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock {sleepMutex};
+            stopping = true;
+        }
+        wakeUp.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Pool shared by every event, using all hardware threads
+     */
+    static ThreadPool& Default() {
+        static ThreadPool pool {std::max(1u, std::thread::hardware_concurrency()) - 1};
+        return pool;
+    }
+
+    std::size_t Concurrency() const override {
+        return workers.size() + 1;
+    }
+
+    void ParallelFor(std::size_t count, const Delegate<void(std::size_t)>& task) override {
+        if (count == 0) {
+            return;
+        }
+        if (count == 1 || workers.empty()) {
+            for (std::size_t i = 0; i < count; ++i) {
+                task(i);
+            }
+            return;
+        }
+
+        Batch batch {&task, count};
+        {
+            // Counted before the jobs are pushed, so taking a job never makes the counter wrap around
+            std::lock_guard<std::mutex> lock {sleepMutex};
+            queued.fetch_add(count);
+        }
+        // Spread the jobs round robin, starting at a different queue each call
+        std::size_t first {nextQueue.fetch_add(1, std::memory_order_relaxed)};
+        for (std::size_t i = 0; i < count; ++i) {
+            Queue& queue {*queues[(first + i) % queues.size()]};
+            std::lock_guard<std::mutex> lock {queue.mutex};
+            queue.jobs.push_back({&batch, i});
+        }
+        wakeUp.notify_all();
+
+        // Help until every job of this call is done. Jobs of other calls may be run too.
+        Job job;
+        while (batch.remaining.load(std::memory_order_acquire) != 0) {
+            if (TryTake(queues.size(), job)) {
+                Run(job);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+};
+#endif // __THREAD_POOL_H__
@@ -0,0 +1,37 @@
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+//* Small helpers shared by the benchmark programs in this folder.
+
+/**
+ * @brief Keeps the compiler from optimizing away a value computed by a benchmark
+ */
+template <class T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief Runs func the given number of times and returns the average time per run in nanoseconds
+ */
+template <class Func>
+double NsPerRun(std::size_t runs, Func&& func) {
+    func(); // Warm up
+    auto start {std::chrono::steady_clock::now()};
+    for (std::size_t i = 0; i < runs; ++i) {
+        func();
+    }
+    std::chrono::duration<double, std::nano> elapsed {std::chrono::steady_clock::now() - start};
+    return elapsed.count() / static_cast<double>(runs);
+}
+
+#endif // __BENCH_H__
@@ -0,0 +1,66 @@
+// Benchmark: subscribing many handlers and tearing them down, default allocator against a per level arena
+
+#include <chrono>
+#include <cstdio>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "../Event.hpp"
+#include "Bench.hpp"
+
+struct Listener {
+    int total {0};
+
+    void OnValue(int value) {
+        total += value;
+    }
+};
+
+//* Subscribes every instance to a few events, as a level load would, and destroys everything. Returns ns per subscriber.
+template <class MakeEvent, class Reset>
+double LoadAndUnload(std::vector<Listener>& instances, const std::vector<std::string>& ids, MakeEvent&& makeEvent, Reset&& reset) {
+    constexpr std::size_t levels {8};
+    auto start {std::chrono::steady_clock::now()};
+    for (std::size_t level = 0; level < levels; ++level) {
+        {
+            std::vector<PmrEvent<void(int)>> events;
+            for (std::size_t i = 0; i < 4; ++i) {
+                events.push_back(makeEvent());
+            }
+            for (std::size_t i = 0; i < instances.size(); ++i) {
+                auto& event {events[i % events.size()]};
+                event.Subscribe<&Listener::OnValue>(&instances[i]);
+                event.Subscribe(ids[i % ids.size()], &Listener::OnValue, &instances[i]);
+            }
+            events.front().Invoke(1);
+            DoNotOptimize(events);
+        }
+        reset();
+    }
+    std::chrono::duration<double, std::nano> elapsed {std::chrono::steady_clock::now() - start};
+    return elapsed.count() / static_cast<double>(levels * instances.size() * 2);
+}
+
+int main() {
+    // Long enough to not fit in the small string buffer
+    std::vector<std::string> ids;
+    for (std::size_t i = 0; i < 64; ++i) {
+        ids.push_back("Listener::OnValue subscription " + std::to_string(i));
+    }
+
+    std::printf("%-12s %24s %24s %24s\n", "subscribers", "default (ns/sub)", "monotonic arena (ns/sub)", "pool (ns/sub)");
+    for (std::size_t subscribers : {1000, 10000, 100000, 400000}) {
+        std::vector<Listener> instances(subscribers);
+
+        double global {LoadAndUnload(instances, ids, [] { return PmrEvent<void(int)>{}; }, [] {})};
+
+        std::pmr::monotonic_buffer_resource arena;
+        double monotonic {LoadAndUnload(instances, ids, [&] { return PmrEvent<void(int)>{&arena}; }, [&] { arena.release(); })};
+
+        std::pmr::unsynchronized_pool_resource pool;
+        double pooled {LoadAndUnload(instances, ids, [&] { return PmrEvent<void(int)>{&pool}; }, [] {})};
+
+        std::printf("%-12zu %24.1f %24.1f %24.1f\n", subscribers, global, monotonic, pooled);
+    }
+}
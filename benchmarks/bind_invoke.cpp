@@ -0,0 +1,77 @@
+// Benchmark: per-invoke cost of a member function bound at compile time (Subscribe<&Type::Function>)
+// against the runtime member function pointer and the EasyBind + std::function path. Consecutive subscriptions of
+// the same member function are grouped into one delegate, so subscribers alternate between two functions; the last
+// column subscribes the same function for every instance to show the grouped path.
+
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+#include "../Event.hpp"
+#include "Bench.hpp"
+
+struct Listener {
+    int total {0};
+
+    void OnValue(int value) {
+        total += value;
+    }
+
+    void OnOther(int value) {
+        total += value;
+    }
+};
+
+constexpr void (Listener::*Methods[])(int) {&Listener::OnValue, &Listener::OnOther};
+
+template <class Subscribe, class Raise>
+double Measure(std::size_t subscribers, Subscribe&& subscribe, Raise&& raise) {
+    std::vector<Listener> instances(subscribers);
+    for (std::size_t i = 0; i < subscribers; ++i) {
+        subscribe(instances[i], i % 2);
+    }
+
+    std::size_t runs {(1u << 22) / subscribers};
+    double ns {NsPerRun(runs, raise)};
+    DoNotOptimize(instances.front().total);
+    return ns / static_cast<double>(subscribers);
+}
+
+int main() {
+    std::printf("%-12s %20s %26s %25s %25s\n", "subscribers", "EasyBind (ns/call)", "runtime member (ns/call)",
+                "Subscribe<&M> (ns/call)", "grouped (ns/call)");
+    for (std::size_t subscribers : {1, 16, 256, 4096}) {
+        // What Event stored for member functions before it had its own delegate
+        std::vector<std::function<void(int)>> functions;
+        double easyBind {Measure(subscribers,
+            [&](Listener& instance, std::size_t method) { functions.push_back(EasyBind(Methods[method], &instance)); },
+            [&] {
+                for (auto& func : functions) {
+                    func(1);
+                }
+            })};
+
+        Event<void(int)> runtimeEvent;
+        double runtime {Measure(subscribers,
+            [&](Listener& instance, std::size_t method) { runtimeEvent.Subscribe("OnValue", Methods[method], &instance); },
+            [&] { runtimeEvent.Invoke(1); })};
+
+        Event<void(int)> boundEvent;
+        double bound {Measure(subscribers,
+            [&](Listener& instance, std::size_t method) {
+                if (method == 0) {
+                    boundEvent.Subscribe<&Listener::OnValue>("OnValue", &instance);
+                } else {
+                    boundEvent.Subscribe<&Listener::OnOther>("OnValue", &instance);
+                }
+            },
+            [&] { boundEvent.Invoke(1); })};
+
+        Event<void(int)> groupedEvent;
+        double grouped {Measure(subscribers,
+            [&](Listener& instance, std::size_t) { groupedEvent.Subscribe<&Listener::OnValue>("OnValue", &instance); },
+            [&] { groupedEvent.Invoke(1); })};
+
+        std::printf("%-12zu %20.2f %26.2f %25.2f %25.2f\n", subscribers, easyBind, runtime, bound, grouped);
+    }
+}
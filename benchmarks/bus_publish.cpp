@@ -0,0 +1,41 @@
+// Benchmark: EventBus::Publish against Invoke on the same Event held directly
+
+#include <cstdio>
+#include <vector>
+
+#include "../Event.hpp"
+#include "../EventBus.hpp"
+#include "Bench.hpp"
+
+struct DamageEvent {
+    int amount;
+};
+
+struct Listener {
+    int health {100};
+
+    void OnDamage(const DamageEvent& damage) {
+        health -= damage.amount;
+    }
+};
+
+int main() {
+    std::printf("%-12s %20s %24s\n", "subscribers", "Event::Invoke (ns)", "EventBus::Publish (ns)");
+    for (std::size_t subscribers : {1, 16, 256, 4096}) {
+        std::vector<Listener> instances(subscribers);
+        std::size_t runs {(1u << 22) / subscribers};
+
+        Event<void(const DamageEvent&)> event;
+        EventBus bus;
+        for (auto& instance : instances) {
+            event.Subscribe<&Listener::OnDamage>(&instance);
+            bus.Subscribe<DamageEvent, &Listener::OnDamage>(&instance);
+        }
+
+        double direct {NsPerRun(runs, [&] { event.Invoke(DamageEvent{1}); })};
+        double published {NsPerRun(runs, [&] { bus.Publish(DamageEvent{1}); })};
+        DoNotOptimize(instances.front().health);
+
+        std::printf("%-12zu %20.1f %24.1f\n", subscribers, direct, published);
+    }
+}
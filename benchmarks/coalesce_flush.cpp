@@ -0,0 +1,63 @@
+// Benchmark: a frame raising a "health changed" event many times, with 4 subscribers, either with Invoke on every
+// change or with Coalesce and one Flush per frame, without a key and with a key per entity. Reports the time per
+// frame and the handler calls it makes.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "../CoalescedEvent.hpp"
+#include "Bench.hpp"
+
+constexpr std::size_t Frames {2000};
+constexpr std::size_t Subscribers {4};
+
+struct Result {
+    double nsPerFrame;
+    double callsPerFrame;
+};
+
+//* raise is called for every change of a frame, then flush once
+template <class Raise, class Flush>
+Result Measure(CoalescedEvent<void(std::uint64_t, int)>& event, std::size_t changes, Raise&& raise, Flush&& flush) {
+    std::size_t calls {0};
+    for (std::size_t i = 0; i < Subscribers; ++i) {
+        event.Subscribe([&](std::uint64_t, int health) { calls += health > 0; });
+    }
+    int health {0};
+    double ns {NsPerRun(Frames, [&] {
+        for (std::size_t change = 0; change < changes; ++change) {
+            raise(static_cast<std::uint64_t>(change), ++health);
+        }
+        flush();
+    })};
+    DoNotOptimize(calls);
+    return {ns, static_cast<double>(calls) / (Frames + 1)};
+}
+
+int main() {
+    constexpr std::size_t Entities {64};
+    std::printf("%-10s %14s %10s %14s %10s %14s %10s   (ns and handler calls per frame)\n", "changes", "invoke", "calls",
+                "coalesce", "calls", "per entity", "calls");
+    for (std::size_t changes : {16u, 256u, 4096u}) {
+        CoalescedEvent<void(std::uint64_t, int)> invoked;
+        Result invoke {Measure(invoked, changes, [&](std::uint64_t entity, int health) { invoked.Invoke(entity, health); },
+                               [] {})};
+
+        CoalescedEvent<void(std::uint64_t, int)> latest;
+        Result coalesce {Measure(latest, changes, [&](std::uint64_t entity, int health) { latest.Coalesce(entity, health); },
+                                 [&] { latest.Flush(); })};
+
+        CoalescedEvent<void(std::uint64_t, int)> perEntity {Entities};
+        Result keyed {Measure(
+            perEntity, changes,
+            [&](std::uint64_t change, int health) {
+                std::uint64_t entity {change % Entities};
+                perEntity.Coalesce(EventKey{entity}, entity, health);
+            },
+            [&] { perEntity.Flush(); })};
+
+        std::printf("%-10zu %14.0f %10.0f %14.0f %10.0f %14.0f %10.0f\n", changes, invoke.nsPerFrame, invoke.callsPerFrame,
+                    coalesce.nsPerFrame, coalesce.callsPerFrame, keyed.nsPerFrame, keyed.callsPerFrame);
+    }
+}
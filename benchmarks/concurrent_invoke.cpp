@@ -0,0 +1,71 @@
+// Benchmark: reader scaling of ConcurrentEvent, compared with an Event behind a mutex.
+// tests/concurrent_event.cpp checks subscribing and unsubscribing while other threads raise it.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../ConcurrentEvent.hpp"
+#include "Bench.hpp"
+
+struct Counter {
+    std::atomic<std::uint64_t> calls {0};
+
+    void OnValue(int value) {
+        calls.fetch_add(static_cast<std::uint64_t>(value), std::memory_order_relaxed);
+    }
+};
+
+//* Total invokes per second with the given number of threads raising the same event
+template <class Raise>
+double Throughput(unsigned threadCount, Raise&& raise) {
+    constexpr std::chrono::milliseconds duration {200};
+    std::atomic<bool> running {true};
+    std::atomic<std::uint64_t> invokes {0};
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&] {
+            std::uint64_t count {0};
+            while (running.load(std::memory_order_relaxed)) {
+                raise();
+                ++count;
+            }
+            invokes.fetch_add(count);
+        });
+    }
+    std::this_thread::sleep_for(duration);
+    running = false;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return static_cast<double>(invokes.load()) / std::chrono::duration<double>(duration).count();
+}
+
+int main() {
+    unsigned maxThreads {std::max(4u, std::thread::hardware_concurrency())};
+
+    constexpr std::size_t subscribers {16};
+    std::vector<Counter> counters(subscribers);
+
+    ConcurrentEvent<void(int)> concurrentEvent;
+    std::mutex mutex;
+    Event<void(int)> lockedEvent;
+    for (auto& counter : counters) {
+        concurrentEvent.Subscribe<&Counter::OnValue>(&counter);
+        lockedEvent.Subscribe<&Counter::OnValue>(&counter);
+    }
+
+    std::printf("%-10s %28s %28s\n", "readers", "mutex + Event (invokes/s)", "ConcurrentEvent (invokes/s)");
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        double locked {Throughput(threads, [&] {
+            std::lock_guard<std::mutex> lock {mutex};
+            lockedEvent.Invoke(1);
+        })};
+        double concurrent {Throughput(threads, [&] { concurrentEvent.Invoke(1); })};
+        std::printf("%-10u %28.0f %28.0f\n", threads, locked, concurrent);
+    }
+}
@@ -0,0 +1,598 @@
+// Benchmark suite: Subscribe, Unsubscribe, RemoveListener and Invoke of Event<R(Args...)> across subscriber counts,
+// argument sizes, kinds of subscriber and churn patterns. Built by the event_bench target of the CMake project.
+//
+// The results are written as JSON (default) or CSV, one benchmark per line, so the output of two versions can be
+// compared, e.g.
+//   event_bench --format=csv --out=before.csv
+//   (change Event.hpp and rebuild)
+//   event_bench --baseline=before.csv --threshold=10
+// The second run lists the benchmarks whose median got more than 10% slower and exits with 1 if there is any.
+//
+// Options:
+//   --format=json|csv   Output format
+//   --out=<path>        Output file instead of stdout
+//   --filter=<text>     Only the benchmarks whose name contains the text
+//   --repetitions=<n>   Timed runs of each benchmark, 5 by default. The min and median are reported.
+//   --quick             16 times less work per run, to check that everything runs
+//   --baseline=<path>   JSON or CSV output of a previous run to compare with
+//   --threshold=<pct>   Slowdown of the median reported as a regression, 10% by default
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../Event.hpp"
+#include "Bench.hpp"
+
+template <std::size_t Bytes>
+struct Payload {
+    unsigned char bytes[Bytes];
+};
+
+//* Arg is the argument type of the event, e.g. Payload<64> or const Payload<256>&
+template <class Arg>
+struct Listener {
+    mutable unsigned total {0};
+
+    void On(Arg payload) {
+        total += payload.bytes[0];
+    }
+
+    void OnOther(Arg payload) {
+        total += payload.bytes[0];
+    }
+
+    void OnConst(Arg payload) const {
+        total += payload.bytes[0];
+    }
+
+    void OnConstOther(Arg payload) const {
+        total += payload.bytes[0];
+    }
+};
+
+unsigned freeTotal {0};
+
+template <class Arg>
+void OnFree(Arg payload) {
+    freeTotal += payload.bytes[0];
+}
+
+//* Consecutive subscriptions of the same member function are grouped into one delegate, so the member kinds
+//* alternate between two functions to keep one delegate per subscriber. The grouped kinds subscribe the same
+//* function for every listener.
+enum class Kind { Member, ConstMember, BoundMember, Free, Lambda, MemberGrouped, BoundMemberGrouped };
+
+constexpr const char* KindNames[] {"member", "const_member", "bound_member", "free", "lambda", "member_grouped",
+                                   "bound_member_grouped"};
+
+template <Kind K, class Arg>
+SubscriptionHandle SubscribeAs(Event<void(Arg)>& event, Listener<Arg>& listener, std::size_t index) {
+    bool other {index % 2 == 1};
+    if constexpr (K == Kind::Member) {
+        return event.Subscribe(other ? &Listener<Arg>::OnOther : &Listener<Arg>::On, &listener);
+    } else if constexpr (K == Kind::ConstMember) {
+        return event.Subscribe(other ? &Listener<Arg>::OnConstOther : &Listener<Arg>::OnConst,
+                               static_cast<const Listener<Arg>*>(&listener));
+    } else if constexpr (K == Kind::BoundMember) {
+        return other ? event.template Subscribe<&Listener<Arg>::OnOther>(&listener)
+                     : event.template Subscribe<&Listener<Arg>::On>(&listener);
+    } else if constexpr (K == Kind::MemberGrouped) {
+        return event.Subscribe(&Listener<Arg>::On, &listener);
+    } else if constexpr (K == Kind::BoundMemberGrouped) {
+        return event.template Subscribe<&Listener<Arg>::On>(&listener);
+    } else if constexpr (K == Kind::Free) {
+        return event.Subscribe(&OnFree<Arg>);
+    } else {
+        return event.Subscribe([&listener](Arg payload) { listener.total += payload.bytes[0]; });
+    }
+}
+
+template <class Func>
+void ForEachKind(Func&& func) {
+    func(std::integral_constant<Kind, Kind::Member>{});
+    func(std::integral_constant<Kind, Kind::ConstMember>{});
+    func(std::integral_constant<Kind, Kind::BoundMember>{});
+    func(std::integral_constant<Kind, Kind::Free>{});
+    func(std::integral_constant<Kind, Kind::Lambda>{});
+    func(std::integral_constant<Kind, Kind::MemberGrouped>{});
+    func(std::integral_constant<Kind, Kind::BoundMemberGrouped>{});
+}
+
+struct Options {
+    std::string format {"json"};
+    std::string out;
+    std::string filter;
+    std::string baseline;
+    std::size_t repetitions {5};
+    std::size_t operations {1 << 18}; // Work of each timed run: handler calls, subscribes, unsubscribes...
+    double threshold {10.0};
+};
+
+struct Result {
+    std::string name;            // Unique, e.g. Invoke/member/subscribers:256/arg_bytes:64
+    std::string operation;       // Invoke, Subscribe, Unsubscribe, RemoveListener or Churn
+    std::string variant;         // Kind of subscriber, unsubscribe order or churn pattern
+    std::size_t subscribers {0}; // Subscribed to the event when the operation runs, or subscribed by it
+    std::size_t argBytes {sizeof(Payload<4>)};
+    std::string argPassing {"value"};
+    std::size_t operations {0};  // Timed per run
+    double minNs {0.0};          // Per operation, over the runs
+    double medianNs {0.0};
+};
+
+Options options;
+std::vector<Result> results;
+
+//* Number of events subscribed to in one timed block, so the clock isn't read for every subscribe of small events
+constexpr std::size_t BatchSize {1024};
+
+const std::string id {"Listener::On benchmark subscription"}; // Too long for the small string buffer
+
+Result Describe(std::string operation, std::string variant, std::size_t subscribers, std::size_t operations) {
+    Result result;
+    result.name = operation + "/" + variant + "/subscribers:" + std::to_string(subscribers);
+    result.operation = std::move(operation);
+    result.variant = std::move(variant);
+    result.subscribers = subscribers;
+    result.operations = operations;
+    return result;
+}
+
+bool Selected(const Result& result) {
+    return result.name.find(options.filter) != std::string::npos;
+}
+
+template <class Func>
+double ElapsedNs(Func&& func) {
+    auto start {std::chrono::steady_clock::now()};
+    func();
+    std::chrono::duration<double, std::nano> elapsed {std::chrono::steady_clock::now() - start};
+    return elapsed.count();
+}
+
+/**
+ * @brief Runs a benchmark once to warm up and then options.repetitions times, and records its result
+ *
+ * @param run Performs result.operations operations and returns the nanoseconds they took, leaving out its setup
+ */
+template <class Run>
+void Measure(Result result, Run&& run) {
+    run();
+    std::vector<double> samples;
+    for (std::size_t i = 0; i < options.repetitions; ++i) {
+        samples.push_back(run() / static_cast<double>(result.operations));
+    }
+    std::sort(samples.begin(), samples.end());
+    result.minNs = samples.front();
+    result.medianNs = samples[samples.size() / 2];
+    results.push_back(std::move(result));
+}
+
+//* Invoke
+
+template <Kind K, class Arg>
+void BenchmarkInvoke(std::size_t subscribers) {
+    using Value = std::decay_t<Arg>;
+    std::size_t invokes {std::max<std::size_t>(1, options.operations / subscribers)};
+    Result result {Describe("Invoke", KindNames[static_cast<int>(K)], subscribers, invokes)};
+    result.argBytes = sizeof(Value);
+    result.argPassing = std::is_reference_v<Arg> ? "const_ref" : "value";
+    result.name += "/arg_bytes:" + std::to_string(result.argBytes) + (std::is_reference_v<Arg> ? "/const_ref" : "");
+    if (!Selected(result)) {
+        return;
+    }
+
+    std::vector<Listener<Arg>> listeners(subscribers);
+    Event<void(Arg)> event;
+    for (std::size_t i = 0; i < listeners.size(); ++i) {
+        SubscribeAs<K>(event, listeners[i], i);
+    }
+    Value payload {};
+    payload.bytes[0] = 1;
+    Measure(std::move(result), [&] {
+        return ElapsedNs([&] {
+            for (std::size_t i = 0; i < invokes; ++i) {
+                event.Invoke(payload);
+            }
+        });
+    });
+    DoNotOptimize(listeners.front().total);
+    DoNotOptimize(freeTotal);
+}
+
+template <class Arg>
+void BenchmarkInvokes() {
+    for (std::size_t subscribers : {1, 16, 256, 4096}) {
+        ForEachKind([&](auto kind) { BenchmarkInvoke<decltype(kind)::value, Arg>(subscribers); });
+    }
+}
+
+//* Subscribe
+
+template <class Subscribe>
+void BenchmarkSubscribe(const std::string& variant, std::size_t subscribers, Subscribe subscribe) {
+    using Arg = Payload<4>;
+    std::size_t events {std::max<std::size_t>(1, BatchSize / subscribers)};
+    std::size_t blocks {std::max<std::size_t>(1, options.operations / (events * subscribers))};
+    Result result {Describe("Subscribe", variant, subscribers, blocks * events * subscribers)};
+    if (!Selected(result)) {
+        return;
+    }
+
+    std::vector<Listener<Arg>> listeners(subscribers);
+    Measure(std::move(result), [&] {
+        double elapsed {0.0};
+        for (std::size_t block = 0; block < blocks; ++block) {
+            std::vector<Event<void(Arg)>> batch(events);
+            elapsed += ElapsedNs([&] {
+                for (auto& event : batch) {
+                    for (std::size_t i = 0; i < subscribers; ++i) {
+                        subscribe(event, listeners[i], i);
+                    }
+                }
+            });
+        }
+        return elapsed;
+    });
+}
+
+void BenchmarkSubscribes() {
+    using Arg = Payload<4>;
+    for (std::size_t subscribers : {1, 16, 256, 4096}) {
+        ForEachKind([&](auto kind) {
+            BenchmarkSubscribe(KindNames[static_cast<int>(decltype(kind)::value)], subscribers,
+                               [](Event<void(Arg)>& event, Listener<Arg>& listener, std::size_t index) {
+                                   SubscribeAs<decltype(kind)::value>(event, listener, index);
+                               });
+        });
+        BenchmarkSubscribe("member_id", subscribers,
+                           [](Event<void(Arg)>& event, Listener<Arg>& listener, std::size_t index) {
+                               event.Subscribe(id, index % 2 == 1 ? &Listener<Arg>::OnOther : &Listener<Arg>::On,
+                                               &listener);
+                           });
+    }
+}
+
+//* Unsubscribe
+
+enum class Order { Forward, Reverse, Random, Id };
+
+void BenchmarkUnsubscribe(Order order, std::size_t subscribers) {
+    using Arg = Payload<4>;
+    constexpr const char* names[] {"handle_forward", "handle_reverse", "handle_random", "id"};
+    std::size_t events {std::max<std::size_t>(1, BatchSize / subscribers)};
+    std::size_t blocks {std::max<std::size_t>(1, options.operations / (events * subscribers))};
+    Result result {Describe("Unsubscribe", names[static_cast<int>(order)], subscribers, blocks * events * subscribers)};
+    if (!Selected(result)) {
+        return;
+    }
+
+    std::vector<Listener<Arg>> listeners(subscribers);
+    std::vector<std::size_t> indices(subscribers);
+    for (std::size_t i = 0; i < subscribers; ++i) {
+        indices[i] = order == Order::Reverse ? subscribers - 1 - i : i;
+    }
+    if (order == Order::Random) {
+        std::shuffle(indices.begin(), indices.end(), std::mt19937 {42});
+    }
+
+    Measure(std::move(result), [&] {
+        double elapsed {0.0};
+        std::vector<SubscriptionHandle> handles(events * subscribers);
+        for (std::size_t block = 0; block < blocks; ++block) {
+            std::vector<Event<void(Arg)>> batch(events);
+            for (std::size_t e = 0; e < events; ++e) {
+                for (std::size_t i = 0; i < subscribers; ++i) {
+                    auto method {i % 2 == 1 ? &Listener<Arg>::OnOther : &Listener<Arg>::On};
+                    handles[e * subscribers + i] = order == Order::Id ? batch[e].Subscribe(id, method, &listeners[i])
+                                                                      : batch[e].Subscribe(method, &listeners[i]);
+                }
+            }
+            elapsed += ElapsedNs([&] {
+                for (std::size_t e = 0; e < events; ++e) {
+                    for (std::size_t i : indices) {
+                        if (order == Order::Id) {
+                            batch[e].Unsubscribe(id, &listeners[i]);
+                        } else {
+                            batch[e].Unsubscribe(handles[e * subscribers + i]);
+                        }
+                    }
+                }
+            });
+        }
+        return elapsed;
+    });
+}
+
+//* RemoveListener
+
+void BenchmarkRemoveListener(std::size_t listenerCount, std::size_t perListener) {
+    using Arg = Payload<4>;
+    std::size_t subscribers {listenerCount * perListener};
+    std::size_t events {std::max<std::size_t>(1, BatchSize / subscribers)};
+    std::size_t blocks {std::max<std::size_t>(1, options.operations / (events * subscribers))};
+    Result result {Describe("RemoveListener", std::to_string(perListener) + "_per_listener", subscribers,
+                            blocks * events * listenerCount)};
+    if (!Selected(result)) {
+        return;
+    }
+
+    std::vector<Listener<Arg>> listeners(listenerCount);
+    Measure(std::move(result), [&] {
+        double elapsed {0.0};
+        for (std::size_t block = 0; block < blocks; ++block) {
+            std::vector<Event<void(Arg)>> batch(events);
+            for (auto& event : batch) {
+                for (auto& listener : listeners) {
+                    // Member, const member and compile time member functions all belong to the instance
+                    for (std::size_t i = 0; i < perListener; ++i) {
+                        switch (i % 3) {
+                            case 0: SubscribeAs<Kind::Member>(event, listener, i); break;
+                            case 1: SubscribeAs<Kind::ConstMember>(event, listener, i); break;
+                            default: SubscribeAs<Kind::BoundMember>(event, listener, i); break;
+                        }
+                    }
+                }
+            }
+            elapsed += ElapsedNs([&] {
+                for (auto& event : batch) {
+                    for (auto& listener : listeners) {
+                        event.RemoveListener(&listener);
+                    }
+                }
+            });
+        }
+        return elapsed;
+    });
+}
+
+//* Churn, a steady number of subscribers while some come and go. One operation is one Invoke with its churn.
+
+enum class Churn { Temporary, ReplaceOldest, ReplaceRandom, FromHandler };
+
+void BenchmarkChurn(Churn churn, std::size_t subscribers) {
+    using Arg = Payload<4>;
+    constexpr const char* names[] {"temporary", "replace_oldest", "replace_random", "from_handler"};
+    std::size_t invokes {std::max<std::size_t>(64, options.operations / subscribers)};
+    Result result {Describe("Churn", names[static_cast<int>(churn)], subscribers, invokes)};
+    if (!Selected(result)) {
+        return;
+    }
+
+    std::vector<Listener<Arg>> listeners(subscribers);
+    Listener<Arg> temporary;
+    std::vector<SubscriptionHandle> handles(subscribers);
+    Event<void(Arg)> event;
+    for (std::size_t i = 0; i < subscribers; ++i) {
+        handles[i] = SubscribeAs<Kind::Member>(event, listeners[i], i);
+    }
+    std::vector<std::size_t> replaced(invokes);
+    std::mt19937 random {42};
+    for (std::size_t i = 0; i < invokes; ++i) {
+        replaced[i] = churn == Churn::ReplaceRandom ? random() % subscribers : i % subscribers;
+    }
+
+    // Replaces one subscriber from inside Invoke, which defers the new subscription until the Invoke returns
+    std::size_t next {0};
+    SubscriptionHandle driver;
+    if (churn == Churn::FromHandler) {
+        driver = event.Subscribe([&](Arg) {
+            std::size_t i {replaced[next++ % invokes]};
+            event.Unsubscribe(handles[i]);
+            handles[i] = SubscribeAs<Kind::Member>(event, listeners[i], i);
+        }, 1);
+    }
+
+    Arg payload {};
+    payload.bytes[0] = 1;
+    Measure(std::move(result), [&] {
+        return ElapsedNs([&] {
+            for (std::size_t n = 0; n < invokes; ++n) {
+                if (churn == Churn::Temporary) {
+                    // A function no subscriber uses, so the temporary never joins the last group
+                    SubscriptionHandle handle {event.Subscribe(&Listener<Arg>::OnConst, &temporary)};
+                    event.Invoke(payload);
+                    event.Unsubscribe(handle);
+                } else if (churn == Churn::FromHandler) {
+                    event.Invoke(payload);
+                } else {
+                    std::size_t i {replaced[n]};
+                    event.Unsubscribe(handles[i]);
+                    handles[i] = SubscribeAs<Kind::Member>(event, listeners[i], i);
+                    event.Invoke(payload);
+                }
+            }
+        });
+    });
+    DoNotOptimize(listeners.front().total);
+}
+
+//* Output
+
+void WriteJson(std::FILE* file) {
+    std::fputs("{\n\"context\":{", file);
+#if defined(__clang__) || defined(__GNUC__)
+    std::fprintf(file, "\"compiler\":\"%s\",", __VERSION__);
+#elif defined(_MSC_VER)
+    std::fprintf(file, "\"compiler\":\"MSVC %d\",", _MSC_VER);
+#endif
+#ifdef NDEBUG
+    const char* assertions {"false"};
+#else
+    const char* assertions {"true"};
+#endif
+    std::fprintf(file, "\"cplusplus\":%ld,\"assertions\":%s,\"repetitions\":%zu,\"operations\":%zu},\n\"benchmarks\":[\n",
+                 static_cast<long>(__cplusplus), assertions, options.repetitions, options.operations);
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result& result {results[i]};
+        std::fprintf(file, "{\"name\":\"%s\",\"operation\":\"%s\",\"variant\":\"%s\",\"subscribers\":%zu,\"arg_bytes\":%zu,"
+                           "\"arg_passing\":\"%s\",\"operations\":%zu,\"ns_per_op_min\":%.3f,\"ns_per_op_median\":%.3f,"
+                           "\"ops_per_second\":%.0f}%s\n",
+                     result.name.c_str(), result.operation.c_str(), result.variant.c_str(), result.subscribers, result.argBytes,
+                     result.argPassing.c_str(), result.operations, result.minNs, result.medianNs, 1e9 / result.medianNs,
+                     i + 1 < results.size() ? "," : "");
+    }
+    std::fputs("]\n}\n", file);
+}
+
+void WriteCsv(std::FILE* file) {
+    std::fputs("name,operation,variant,subscribers,arg_bytes,arg_passing,operations,ns_per_op_min,ns_per_op_median,ops_per_second\n",
+               file);
+    for (const Result& result : results) {
+        std::fprintf(file, "%s,%s,%s,%zu,%zu,%s,%zu,%.3f,%.3f,%.0f\n", result.name.c_str(), result.operation.c_str(),
+                     result.variant.c_str(), result.subscribers, result.argBytes, result.argPassing.c_str(), result.operations,
+                     result.minNs, result.medianNs, 1e9 / result.medianNs);
+    }
+}
+
+//* Median of each benchmark in a previous JSON or CSV output, by name
+std::map<std::string, double> ReadBaseline(const std::string& path) {
+    std::map<std::string, double> medians;
+    std::ifstream file {path};
+    std::string line;
+    std::size_t nameColumn {0};
+    std::size_t medianColumn {0};
+    bool csv {false};
+    while (std::getline(file, line)) {
+        if (line.rfind("name,", 0) == 0) {
+            csv = true;
+            std::size_t column {0};
+            for (std::size_t begin = 0, end = 0; end != std::string::npos; begin = end + 1, ++column) {
+                end = line.find(',', begin);
+                if (line.compare(begin, end - begin, "ns_per_op_median") == 0) {
+                    medianColumn = column;
+                }
+            }
+        } else if (csv) {
+            std::vector<std::string> fields;
+            for (std::size_t begin = 0, end = 0; end != std::string::npos; begin = end + 1) {
+                end = line.find(',', begin);
+                fields.push_back(line.substr(begin, end - begin));
+            }
+            if (fields.size() > std::max(nameColumn, medianColumn)) {
+                medians[fields[nameColumn]] = std::strtod(fields[medianColumn].c_str(), nullptr);
+            }
+        } else {
+            std::size_t name {line.find("\"name\":\"")};
+            std::size_t median {line.find("\"ns_per_op_median\":")};
+            if (name != std::string::npos && median != std::string::npos) {
+                name += 8;
+                medians[line.substr(name, line.find('"', name) - name)] = std::strtod(line.c_str() + median + 19, nullptr);
+            }
+        }
+    }
+    return medians;
+}
+
+//* Lists the benchmarks slower than in the baseline by more than the threshold, returns how many there are
+std::size_t CompareWithBaseline() {
+    std::map<std::string, double> baseline {ReadBaseline(options.baseline)};
+    if (baseline.empty()) {
+        std::fprintf(stderr, "No benchmark results in %s\n", options.baseline.c_str());
+        return 0;
+    }
+    std::size_t compared {0};
+    std::size_t slower {0};
+    for (const Result& result : results) {
+        auto previous {baseline.find(result.name)};
+        if (previous == baseline.end() || previous->second <= 0.0) {
+            continue;
+        }
+        ++compared;
+        double change {(result.medianNs / previous->second - 1.0) * 100.0};
+        if (change > options.threshold) {
+            ++slower;
+            std::fprintf(stderr, "slower: %-56s %10.3f -> %10.3f ns (+%.1f%%)\n", result.name.c_str(), previous->second,
+                         result.medianNs, change);
+        }
+    }
+    std::fprintf(stderr, "%zu of %zu benchmarks are more than %.1f%% slower than %s\n", slower, compared, options.threshold,
+                 options.baseline.c_str());
+    return slower;
+}
+
+bool ParseArguments(int argc, char** argv) {
+    for (int i = 1; i < argc; ++i) {
+        std::string argument {argv[i]};
+        std::size_t equals {argument.find('=')};
+        std::string name {argument.substr(0, equals)};
+        std::string value {equals != std::string::npos ? argument.substr(equals + 1) : std::string{}};
+        if (name == "--format" && (value == "json" || value == "csv")) {
+            options.format = value;
+        } else if (name == "--out") {
+            options.out = value;
+        } else if (name == "--filter") {
+            options.filter = value;
+        } else if (name == "--repetitions" && std::atoi(value.c_str()) > 0) {
+            options.repetitions = static_cast<std::size_t>(std::atoi(value.c_str()));
+        } else if (name == "--quick") {
+            options.operations /= 16;
+        } else if (name == "--baseline") {
+            options.baseline = value;
+        } else if (name == "--threshold") {
+            options.threshold = std::atof(value.c_str());
+        } else {
+            std::fprintf(stderr, "Unknown option %s\nUsage: %s [--format=json|csv] [--out=<path>] [--filter=<text>] "
+                                 "[--repetitions=<n>] [--quick] [--baseline=<path>] [--threshold=<percent>]\n",
+                         argv[i], argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    if (!ParseArguments(argc, argv)) {
+        return 2;
+    }
+
+    BenchmarkInvokes<Payload<4>>();
+    BenchmarkInvokes<Payload<64>>();
+    BenchmarkInvokes<Payload<256>>();
+    BenchmarkInvokes<const Payload<256>&>();
+
+    BenchmarkSubscribes();
+
+    for (std::size_t subscribers : {1, 16, 256, 4096}) {
+        for (Order order : {Order::Forward, Order::Reverse, Order::Random, Order::Id}) {
+            BenchmarkUnsubscribe(order, subscribers);
+        }
+    }
+
+    for (std::size_t listeners : {16, 256, 4096}) {
+        BenchmarkRemoveListener(listeners, 1);
+        BenchmarkRemoveListener(listeners, 4);
+    }
+
+    for (std::size_t subscribers : {16, 256, 4096}) {
+        for (Churn churn : {Churn::Temporary, Churn::ReplaceOldest, Churn::ReplaceRandom, Churn::FromHandler}) {
+            BenchmarkChurn(churn, subscribers);
+        }
+    }
+
+    std::FILE* file {options.out.empty() ? stdout : std::fopen(options.out.c_str(), "w")};
+    if (!file) {
+        std::fprintf(stderr, "Can't write %s\n", options.out.c_str());
+        return 2;
+    }
+    if (options.format == "csv") {
+        WriteCsv(file);
+    } else {
+        WriteJson(file);
+    }
+    if (file != stdout) {
+        std::fclose(file);
+    }
+
+    if (!options.baseline.empty() && CompareWithBaseline() > 0) {
+        return 1;
+    }
+}
@@ -0,0 +1,109 @@
+// Benchmark: memory used by empty events and by each subscriber, Event against CompactEvent
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "../CompactEvent.hpp"
+#include "../Event.hpp"
+#include "Bench.hpp"
+
+//* Every allocation is prefixed with its size, so the program knows how many heap bytes are alive at any time.
+//* GCC can't tell the replaced operators apart from malloc/free once they're inlined and warns about the pairing.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+
+static std::size_t liveBytes {0};
+
+void* operator new(std::size_t size) {
+    void* memory {std::malloc(size + sizeof(std::max_align_t))};
+    if (!memory) {
+        throw std::bad_alloc{};
+    }
+    *static_cast<std::size_t*>(memory) = size;
+    liveBytes += size;
+    return static_cast<unsigned char*>(memory) + sizeof(std::max_align_t);
+}
+
+void operator delete(void* memory) noexcept {
+    if (memory) {
+        void* block {static_cast<unsigned char*>(memory) - sizeof(std::max_align_t)};
+        liveBytes -= *static_cast<std::size_t*>(block);
+        std::free(block);
+    }
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    operator delete(memory);
+}
+
+struct Listener {
+    int total {0};
+
+    void OnValue(int value) {
+        total += value;
+    }
+};
+
+//* Heap bytes used by an event after subscribing the member function of each instance
+template <class EventType>
+std::size_t HeapBytes(std::vector<Listener>& instances) {
+    std::size_t before {liveBytes};
+    std::size_t used {0};
+    {
+        EventType event;
+        for (auto& instance : instances) {
+            event.template Subscribe<&Listener::OnValue>(&instance);
+        }
+        used = liveBytes - before;
+        event.Invoke(1);
+    }
+    return used;
+}
+
+//* Like an entity embedding several events that usually have no subscribers
+template <class EventType>
+struct Entity {
+    EventType onDamage, onHeal, onDeath, onSpawn;
+};
+
+int main() {
+    std::printf("sizeof(Event<void(int)>)        %zu bytes\n", sizeof(Event<void(int)>));
+    std::printf("sizeof(CompactEvent<void(int)>) %zu bytes\n\n", sizeof(CompactEvent<void(int)>));
+
+    std::printf("%-12s %22s %22s\n", "subscribers", "Event (bytes/sub)", "CompactEvent (bytes/sub)");
+    for (std::size_t subscribers : {1, 16, 256, 4096}) {
+        std::vector<Listener> instances(subscribers);
+        // The size of the event object itself is counted too, it is what a subscriber costs its owner
+        double flat {static_cast<double>(HeapBytes<Event<void(int)>>(instances) + sizeof(Event<void(int)>))};
+        double compact {static_cast<double>(HeapBytes<CompactEvent<void(int)>>(instances) + sizeof(CompactEvent<void(int)>))};
+        std::printf("%-12zu %22.1f %22.1f\n", subscribers, flat / static_cast<double>(subscribers),
+                    compact / static_cast<double>(subscribers));
+    }
+
+    constexpr std::size_t entities {1000000};
+    std::printf("\n%zu entities with 4 events, 1%% of them with one subscriber:\n", entities);
+    Listener listener;
+    {
+        std::size_t before {liveBytes};
+        std::vector<Entity<Event<void(int)>>> world(entities);
+        for (std::size_t i = 0; i < entities; i += 100) {
+            world[i].onDamage.Subscribe<&Listener::OnValue>(&listener);
+        }
+        std::printf("  Event         %8.1f MiB\n", static_cast<double>(liveBytes - before) / (1024.0 * 1024.0));
+        DoNotOptimize(world);
+    }
+    {
+        std::size_t before {liveBytes};
+        std::vector<Entity<CompactEvent<void(int)>>> world(entities);
+        for (std::size_t i = 0; i < entities; i += 100) {
+            world[i].onDamage.Subscribe<&Listener::OnValue>(&listener);
+        }
+        std::printf("  CompactEvent  %8.1f MiB\n", static_cast<double>(liveBytes - before) / (1024.0 * 1024.0));
+        DoNotOptimize(world);
+    }
+}
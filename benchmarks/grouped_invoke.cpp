@@ -0,0 +1,89 @@
+// Benchmark: Invoke with subscriptions of the same member function grouped into one delegate, against the same
+// subscriptions interleaved with another function so that each one keeps its own delegate. Both events call every
+// instance once per Invoke; the grouped one makes one indirect call per group instead of one per subscriber.
+
+#include <cstdio>
+#include <vector>
+
+#include "../Event.hpp"
+#include "Bench.hpp"
+
+struct Unit {
+    int health {100};
+
+    void TakeDamage(int damage) {
+        health -= damage;
+    }
+
+    void Heal(int amount) {
+        health += amount;
+    }
+
+    static void TakeDamageAll(Span<Unit*> units, int damage) {
+        for (Unit* unit : units) {
+            unit->health -= damage;
+        }
+    }
+
+    static void HealAll(Span<Unit*> units, int amount) {
+        for (Unit* unit : units) {
+            unit->health += amount;
+        }
+    }
+};
+
+//* Subscribes TakeDamage and Heal for every unit, one function after the other (grouped) or alternating (not grouped)
+template <auto Damage, auto Heal>
+double Measure(std::vector<Unit>& units, bool grouped, std::size_t runs) {
+    Event<void(int)> event;
+    if (grouped) {
+        for (auto& unit : units) {
+            event.Subscribe<Damage>(&unit);
+        }
+        for (auto& unit : units) {
+            event.Subscribe<Heal>(&unit);
+        }
+    } else {
+        for (auto& unit : units) {
+            event.Subscribe<Damage>(&unit);
+            event.Subscribe<Heal>(&unit);
+        }
+    }
+    return NsPerRun(runs, [&] { event.Invoke(1); });
+}
+
+double MeasureRuntime(std::vector<Unit>& units, bool grouped, std::size_t runs) {
+    Event<void(int)> event;
+    if (grouped) {
+        for (auto& unit : units) {
+            event.Subscribe(&Unit::TakeDamage, &unit);
+        }
+        for (auto& unit : units) {
+            event.Subscribe(&Unit::Heal, &unit);
+        }
+    } else {
+        for (auto& unit : units) {
+            event.Subscribe(&Unit::TakeDamage, &unit);
+            event.Subscribe(&Unit::Heal, &unit);
+        }
+    }
+    return NsPerRun(runs, [&] { event.Invoke(1); });
+}
+
+int main() {
+    std::printf("%-12s %12s %12s %12s %12s %12s   (ns per Invoke, 2 calls per unit)\n", "units", "interleaved", "grouped",
+                "runtime int.", "runtime grp.", "batch");
+    for (std::size_t count : {1, 16, 256, 4096}) {
+        std::vector<Unit> units(count);
+        std::size_t runs {(1u << 21) / count};
+
+        double interleaved {Measure<&Unit::TakeDamage, &Unit::Heal>(units, false, runs)};
+        double grouped {Measure<&Unit::TakeDamage, &Unit::Heal>(units, true, runs)};
+        double runtimeInterleaved {MeasureRuntime(units, false, runs)};
+        double runtimeGrouped {MeasureRuntime(units, true, runs)};
+        double batch {Measure<&Unit::TakeDamageAll, &Unit::HealAll>(units, true, runs)};
+        std::printf("%-12zu %12.1f %12.1f %12.1f %12.1f %12.1f\n", count, interleaved, grouped, runtimeInterleaved,
+                    runtimeGrouped, batch);
+        DoNotOptimize(units.front().health);
+    }
+}
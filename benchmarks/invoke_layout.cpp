@@ -0,0 +1,74 @@
+// Benchmark: Invoke cost of the flat delegate array against the previous nested unordered_map layout. Subscribers
+// alternate between two member functions so the flat array keeps one delegate per subscriber instead of grouping
+// them; grouped_invoke.cpp measures the grouped path.
+
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../Event.hpp"
+#include "Bench.hpp"
+
+//* The storage Event used before delegates were stored contiguously.
+template <class>
+class NestedMapEvent;
+
+template <class R, class... Args>
+class NestedMapEvent<R(Args...)> {
+private:
+    using Delegate = std::function<R(Args...)>;
+    using FuncMap = std::unordered_map<std::string, Delegate>;
+    std::unordered_map<void*, FuncMap> listeners;
+
+public:
+    template <class Type>
+    void Subscribe(const std::string& id, R(Type::*func)(Args... args), Type* invoker) {
+        listeners[invoker].emplace(id, EasyBind(func, invoker));
+    }
+
+    void Invoke(Args... args) {
+        for (auto& listener : listeners) {
+            for (auto& func : listener.second) {
+                func.second(std::forward<decltype(args)>(args)...);
+            }
+        }
+    }
+};
+
+struct Listener {
+    int total {0};
+
+    void OnValue(int value) {
+        total += value;
+    }
+
+    void OnOther(int value) {
+        total += value;
+    }
+};
+
+template <class EventType>
+double Measure(std::size_t subscribers) {
+    std::vector<Listener> instances(subscribers);
+    EventType event;
+    for (std::size_t i = 0; i < subscribers; ++i) {
+        event.Subscribe("OnValue", i % 2 == 0 ? &Listener::OnValue : &Listener::OnOther, &instances[i]);
+    }
+
+    // Keep the total number of handler calls roughly constant across sizes.
+    std::size_t runs {(1u << 22) / subscribers};
+    double ns {NsPerRun(runs, [&] { event.Invoke(1); })};
+    DoNotOptimize(instances.front().total);
+    return ns;
+}
+
+int main() {
+    std::printf("%-12s %18s %18s %10s\n", "subscribers", "nested maps (ns)", "flat array (ns)", "speedup");
+    for (std::size_t subscribers : {1, 16, 256, 4096}) {
+        double nested {Measure<NestedMapEvent<void(int)>>(subscribers)};
+        double flat {Measure<Event<void(int)>>(subscribers)};
+        std::printf("%-12zu %18.1f %18.1f %9.2fx\n", subscribers, nested, flat, nested / flat);
+    }
+}
@@ -0,0 +1,55 @@
+// Benchmark: reaching one entity through a keyed Invoke against a broadcast where every handler filters by id
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "../Event.hpp"
+#include "Bench.hpp"
+
+struct Entity {
+    std::uint64_t id {0};
+    int health {100};
+
+    void OnDamageFiltered(std::uint64_t target, int amount) {
+        if (target != id) {
+            return;
+        }
+        health -= amount;
+    }
+
+    void OnDamage(std::uint64_t, int amount) {
+        health -= amount;
+    }
+};
+
+int main() {
+    std::printf("%-12s %22s %22s %10s\n", "subscribers", "broadcast + if (ns)", "keyed (ns)", "speedup");
+    for (std::size_t subscribers : {16, 256, 4096, 65536}) {
+        std::vector<Entity> entities(subscribers);
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            entities[i].id = i;
+        }
+        std::size_t runs {(1u << 24) / subscribers};
+
+        Event<void(std::uint64_t, int)> broadcast;
+        Event<void(std::uint64_t, int)> keyed;
+        for (auto& entity : entities) {
+            broadcast.Subscribe<&Entity::OnDamageFiltered>(&entity);
+            keyed.Subscribe<&Entity::OnDamage>(EventKey{entity.id}, &entity);
+        }
+
+        std::uint64_t target {0};
+        double filtered {NsPerRun(runs, [&] {
+            broadcast.Invoke(target, 1);
+            target = (target + 7) % subscribers;
+        })};
+        double byKey {NsPerRun(runs, [&] {
+            keyed.Invoke(EventKey{target}, target, 1);
+            target = (target + 7) % subscribers;
+        })};
+        DoNotOptimize(entities.front().health);
+
+        std::printf("%-12zu %22.1f %22.1f %9.1fx\n", subscribers, filtered, byKey, filtered / byKey);
+    }
+}
@@ -0,0 +1,125 @@
+// Benchmark: throughput of raising an event from 1 to 16 producer threads through a MailboxEvent pumped by the owner
+// thread, against the hand-rolled alternative, a std::mutex guarded vector the owner swaps out and raises from.
+// The drop columns report how many posts got through when the producers outrun the owner.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../MailboxEvent.hpp"
+#include "Bench.hpp"
+
+constexpr std::size_t PostsPerProducer {1u << 18};
+constexpr std::size_t Capacity {4096};
+
+//* Locked queue in front of an event, as written by hand without the mailbox
+struct LockedQueue {
+    Event<void(int, std::uint64_t)> event;
+    std::mutex mutex;
+    std::vector<std::pair<int, std::uint64_t>> queue;
+    std::vector<std::pair<int, std::uint64_t>> pumping;
+
+    bool Post(int producer, std::uint64_t value) {
+        std::lock_guard<std::mutex> lock {mutex};
+        queue.emplace_back(producer, value);
+        return true;
+    }
+
+    std::size_t Pump() {
+        {
+            std::lock_guard<std::mutex> lock {mutex};
+            std::swap(queue, pumping);
+        }
+        for (auto& [producer, value] : pumping) {
+            event.Invoke(producer, value);
+        }
+        std::size_t count {pumping.size()};
+        pumping.clear();
+        return count;
+    }
+};
+
+struct Result {
+    double postsPerSecond; // Millions of posts per second, over the time until the owner pumped the last one
+    double delivered;      // Fraction of the posts that were raised
+};
+
+//* Starts the producers and pumps on this thread until all of them finished and the queue is empty
+template <class Queue>
+Result Measure(Queue& queue, unsigned producers) {
+    std::uint64_t sum {0};
+    queue.event.Subscribe([&](int, std::uint64_t value) { sum += value; });
+
+    std::atomic<unsigned> running {producers};
+    std::atomic<bool> start {false};
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < producers; ++i) {
+        threads.emplace_back([&, i] {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (std::size_t post = 0; post < PostsPerProducer; ++post) {
+                queue.Post(static_cast<int>(i), post);
+            }
+            running.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    std::size_t delivered {0};
+    auto begin {std::chrono::steady_clock::now()};
+    start.store(true, std::memory_order_release);
+    while (running.load(std::memory_order_acquire) > 0) {
+        std::size_t pumped {queue.Pump()};
+        delivered += pumped;
+        if (pumped == 0) {
+            std::this_thread::yield();
+        }
+    }
+    delivered += queue.Pump();
+    std::chrono::duration<double> elapsed {std::chrono::steady_clock::now() - begin};
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    DoNotOptimize(sum);
+
+    double posts {static_cast<double>(PostsPerProducer) * producers};
+    return {posts / elapsed.count() / 1e6, static_cast<double>(delivered) / posts};
+}
+
+struct MailboxQueue {
+    MailboxEvent<void(int, std::uint64_t)> event;
+
+    explicit MailboxQueue(MailboxOverflow overflow) : event{Capacity, overflow} {}
+
+    bool Post(int producer, std::uint64_t value) {
+        return event.Post(producer, value);
+    }
+
+    std::size_t Pump() {
+        return event.Pump();
+    }
+};
+
+int main() {
+    std::printf("%-10s %14s %14s %14s %10s %14s %10s   (millions of posts per second)\n", "producers", "mutex queue",
+                "mailbox", "drop oldest", "delivered", "drop newest", "delivered");
+    for (unsigned producers : {1u, 2u, 4u, 8u, 16u}) {
+        LockedQueue locked;
+        MailboxQueue blocking {MailboxOverflow::Block};
+        MailboxQueue oldest {MailboxOverflow::DropOldest};
+        MailboxQueue newest {MailboxOverflow::DropNewest};
+
+        Result lockedResult {Measure(locked, producers)};
+        Result blockingResult {Measure(blocking, producers)};
+        Result oldestResult {Measure(oldest, producers)};
+        Result newestResult {Measure(newest, producers)};
+        std::printf("%-10u %14.1f %14.1f %14.1f %9.0f%% %14.1f %9.0f%%\n", producers, lockedResult.postsPerSecond,
+                    blockingResult.postsPerSecond, oldestResult.postsPerSecond, oldestResult.delivered * 100,
+                    newestResult.postsPerSecond, newestResult.delivered * 100);
+    }
+}
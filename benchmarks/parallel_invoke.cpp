@@ -0,0 +1,50 @@
+// Benchmark: InvokeParallel scaling from 1 to hardware_concurrency threads against a serial Invoke
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "../ThreadPool.hpp"
+#include "Bench.hpp"
+
+//* Some independent work per subscriber, like per-entity AI reacting to a tick
+struct Agent {
+    float state {1.0f};
+
+    void OnTick(const float& deltaTime) {
+        for (int i = 0; i < 64; ++i) {
+            state = std::sqrt(state * state + deltaTime);
+        }
+    }
+};
+
+int main() {
+    constexpr std::size_t subscribers {16384};
+    std::vector<Agent> agents(subscribers);
+    Event<void(const float&)> tick;
+    for (auto& agent : agents) {
+        tick.Subscribe<&Agent::OnTick>(&agent);
+    }
+
+    const float deltaTime {0.016f};
+    double serial {NsPerRun(20, [&] { tick.Invoke(deltaTime); })};
+    std::printf("%zu subscribers, serial Invoke: %.1f us\n", subscribers, serial / 1000.0);
+
+    std::printf("%-10s %18s %10s\n", "threads", "InvokeParallel (us)", "speedup");
+    // Powers of two, plus all the hardware threads when that isn't one
+    unsigned maxThreads {std::max(1u, std::thread::hardware_concurrency())};
+    std::vector<unsigned> threadCounts;
+    for (unsigned threads = 1; threads < maxThreads; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    for (unsigned threads : threadCounts) {
+        ThreadPool pool {threads - 1};
+        double parallel {NsPerRun(20, [&] { tick.InvokeParallel(pool, deltaTime); })};
+        std::printf("%-10u %18.1f %9.2fx\n", threads, parallel / 1000.0, serial / parallel);
+    }
+    DoNotOptimize(agents.front().state);
+}
@@ -0,0 +1,100 @@
+// Benchmark: Invoke with each Event policy against a bare loop over the same delegates.
+// The Invoke* functions aren't inlined so their code can be compared, e.g.
+//   objdump -d --no-show-raw-insn policy_overhead | c++filt | less
+// With the no-op policies InvokeEvent is the loop of InvokeBare plus the dispatch depth counter that makes
+// Subscribe/Unsubscribe from a handler safe; logging, locking and ordering add no instructions.
+// Every subscriber is its own lambda, so the event doesn't group them into one delegate (grouped_invoke.cpp measures
+// that) and both sides call the same delegates.
+
+#include <cstdio>
+#include <vector>
+
+#include "../ConcurrentEvent.hpp"
+#include "../Event.hpp"
+#include "../EventTrace.hpp"
+#include "Bench.hpp"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define NOINLINE __attribute__((noinline))
+#else
+#define NOINLINE __declspec(noinline)
+#endif
+
+struct Listener {
+    int total {0};
+
+    void OnValue(int value) {
+        total += value;
+    }
+
+    //* Lambdas aren't grouped like member function subscriptions
+    auto Handler() {
+        return [this](int value) { OnValue(value); };
+    }
+};
+
+using NoOpEvent = Event<void(int), EventPolicy<NoLogging>>;
+using InsertionEvent = Event<void(int), EventPolicy<NoLogging, SingleThreaded, InlineStorage<>, InsertionOrder>>;
+using TracedEvent = Event<void(int), EventPolicy<TraceLogging>>;
+using MutexEvent = Event<void(int), EventPolicy<NoLogging, MutexThreaded>>;
+using LockFreeEvent = Event<void(int), EventPolicy<NoLogging, LockFreeThreaded>>;
+
+NOINLINE void InvokeBare(const std::vector<Delegate<void(int)>>& delegates, int value) {
+    for (auto& func : delegates) {
+        if (func) {
+            func(value);
+        }
+    }
+}
+
+NOINLINE void InvokeEvent(NoOpEvent& event, int value) {
+    event.Invoke(value);
+}
+
+NOINLINE void InvokeInsertion(InsertionEvent& event, int value) {
+    event.Invoke(value);
+}
+
+NOINLINE void InvokeTraced(TracedEvent& event, int value) {
+    event.Invoke(value);
+}
+
+NOINLINE void InvokeMutex(MutexEvent& event, int value) {
+    event.Invoke(value);
+}
+
+NOINLINE void InvokeLockFree(LockFreeEvent& event, int value) {
+    event.Invoke(value);
+}
+
+template <class EventType, class Invoke>
+double Measure(std::vector<Listener>& listeners, std::size_t runs, Invoke invoke) {
+    EventType event;
+    for (auto& listener : listeners) {
+        event.Subscribe(listener.Handler());
+    }
+    return NsPerRun(runs, [&] { invoke(event, 1); });
+}
+
+int main() {
+    std::printf("%-12s %10s %10s %10s %10s %10s %10s   (ns per Invoke)\n", "subscribers", "bare loop", "no-op", "insertion",
+                "mutex", "lock-free", "traced");
+    for (std::size_t subscribers : {1, 16, 256, 4096}) {
+        std::vector<Listener> listeners(subscribers);
+        std::size_t runs {(1u << 22) / subscribers};
+
+        std::vector<Delegate<void(int)>> delegates;
+        for (auto& listener : listeners) {
+            delegates.push_back(listener.Handler());
+        }
+        double bare {NsPerRun(runs, [&] { InvokeBare(delegates, 1); })};
+        double noOp {Measure<NoOpEvent>(listeners, runs, InvokeEvent)};
+        double insertion {Measure<InsertionEvent>(listeners, runs, InvokeInsertion)};
+        double mutex {Measure<MutexEvent>(listeners, runs, InvokeMutex)};
+        double lockFree {Measure<LockFreeEvent>(listeners, runs, InvokeLockFree)};
+        double traced {Measure<TracedEvent>(listeners, runs / 16 + 1, InvokeTraced)};
+        std::printf("%-12zu %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", subscribers, bare, noOp, insertion, mutex, lockFree,
+                    traced);
+        DoNotOptimize(listeners.front().total);
+    }
+}
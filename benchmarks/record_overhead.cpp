@@ -0,0 +1,59 @@
+// Benchmark: cost an EventRecorder adds to Invoke for arguments of 4 to 256 bytes, including the writes of its
+// buffer to the file, and how fast an EventReplayer raises the recording again.
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+#include <unistd.h>
+
+#include "../EventRecording.hpp"
+#include "Bench.hpp"
+
+constexpr std::size_t Raises {1u << 20};
+
+template <std::size_t Bytes>
+struct Payload {
+    unsigned char bytes[Bytes];
+};
+
+template <std::size_t Bytes>
+void Measure() {
+    using Args = Payload<Bytes>;
+    std::string path {"event_system_record_overhead_" + std::to_string(getpid()) + ".bin"};
+    Event<void(const Args&)> event;
+    std::size_t sum {0};
+    event.Subscribe([&](const Args& args) { sum += args.bytes[0]; });
+    Args args {};
+    //* Both measures change the arguments, so the only difference is the recorder
+    auto raise {[&] {
+        ++args.bytes[0];
+        event.Invoke(args);
+    }};
+
+    double bare {NsPerRun(Raises, raise)};
+    double recorded {0};
+    {
+        EventRecorder<void(const Args&)> recorder;
+        recorder.Create(path);
+        recorder.Attach(event);
+        recorded = NsPerRun(Raises, raise);
+    }
+
+    EventReplayer<void(const Args&)> replayer;
+    replayer.Open(path);
+    replayer.Target(0, event);
+    double replayed {NsPerRun(1, [&] { replayer.Replay(); }) / static_cast<double>(replayer.Size())};
+    DoNotOptimize(sum);
+    std::remove(path.c_str());
+
+    std::printf("%-8zu %12.1f %12.1f %12.1f %12.1f\n", Bytes, bare, recorded, recorded - bare, replayed);
+}
+
+int main() {
+    std::printf("%-8s %12s %12s %12s %12s   (ns per raise)\n", "bytes", "invoke", "recorded", "overhead", "replay");
+    Measure<4>();
+    Measure<16>();
+    Measure<64>();
+    Measure<256>();
+}
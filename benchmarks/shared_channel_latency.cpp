@@ -0,0 +1,145 @@
+// Benchmark: round trip latency of raising an event in another process and getting an answer back, through a pair of
+// shared memory channels polled in a loop, against the socket bridge it replaces (a socketpair with the arguments
+// written as bytes). Also reports the cost of Invoke on the publishing side with and without an attached publisher.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "../SharedEventChannel.hpp"
+#include "Bench.hpp"
+
+constexpr int RoundTrips {20000};
+
+struct Sample {
+    std::uint64_t sequence;
+    double value;
+};
+
+//* Nanoseconds per round trip at the 50th and 99th percentile
+struct Latency {
+    double p50;
+    double p99;
+};
+
+Latency Percentiles(std::vector<double>& samples) {
+    std::sort(samples.begin(), samples.end());
+    return {samples[samples.size() / 2], samples[samples.size() * 99 / 100]};
+}
+
+Latency MeasureSharedMemory() {
+    std::string name {"/event_system_bench_" + std::to_string(getpid())};
+    std::string pingName {name + "_ping"};
+    std::string pongName {name + "_pong"};
+
+    // Both channels are created and mapped before the fork, so no raise is published before its mirror is open
+    Event<void(Sample)> ping;
+    SharedEventPublisher<void(Sample)> pingPublisher;
+    SharedEventPublisher<void(Sample)> pongPublisher;
+    SharedEventMirror<void(Sample)> pings;
+    SharedEventMirror<void(Sample)> pongs;
+    pingPublisher.Create(pingName);
+    pingPublisher.Attach(ping);
+    pongPublisher.Create(pongName);
+    pings.Open(pingName);
+    pongs.Open(pongName);
+
+    pid_t child {fork()};
+    if (child == 0) {
+        // Echoes every ping as a pong
+        bool done {false};
+        pings.Subscribe([&](Sample sample) {
+            pongPublisher.Publish(sample);
+            done = sample.sequence + 1 == RoundTrips;
+        });
+        while (!done) {
+            if (pings.Poll() == 0) {
+                std::this_thread::yield(); // Gives the other process the core on machines with few of them
+            }
+        }
+        _exit(0);
+    }
+
+    bool answered {false};
+    pongs.Subscribe([&](Sample) { answered = true; });
+
+    std::vector<double> samples;
+    samples.reserve(RoundTrips);
+    for (int i = 0; i < RoundTrips; ++i) {
+        auto start {std::chrono::steady_clock::now()};
+        answered = false;
+        ping.Invoke(Sample{static_cast<std::uint64_t>(i), i * 0.5});
+        while (!answered) {
+            if (pongs.Poll() == 0) {
+                std::this_thread::yield();
+            }
+        }
+        samples.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+    }
+    waitpid(child, nullptr, 0);
+    SharedEventRing<Sample>::Remove(pingName);
+    SharedEventRing<Sample>::Remove(pongName);
+    return Percentiles(samples);
+}
+
+Latency MeasureSocket() {
+    int sockets[2];
+    socketpair(AF_UNIX, SOCK_STREAM, 0, sockets);
+    pid_t child {fork()};
+    if (child == 0) {
+        Event<void(Sample)> ping;
+        ping.Subscribe([&](Sample sample) { (void)!write(sockets[1], &sample, sizeof(sample)); });
+        Sample sample {};
+        for (int i = 0; i < RoundTrips; ++i) {
+            if (read(sockets[1], &sample, sizeof(sample)) != sizeof(sample)) {
+                break;
+            }
+            ping.Invoke(sample);
+        }
+        _exit(0);
+    }
+
+    Event<void(Sample)> ping;
+    ping.Subscribe([&](Sample sample) { (void)!write(sockets[0], &sample, sizeof(sample)); });
+    std::vector<double> samples;
+    samples.reserve(RoundTrips);
+    for (int i = 0; i < RoundTrips; ++i) {
+        auto start {std::chrono::steady_clock::now()};
+        ping.Invoke(Sample{static_cast<std::uint64_t>(i), i * 0.5});
+        Sample answer {};
+        (void)!read(sockets[0], &answer, sizeof(answer));
+        samples.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+    }
+    waitpid(child, nullptr, 0);
+    close(sockets[0]);
+    close(sockets[1]);
+    return Percentiles(samples);
+}
+
+int main() {
+    std::string name {"/event_system_bench_" + std::to_string(getpid()) + "_invoke"};
+    Event<void(Sample)> local;
+    local.Subscribe([](Sample sample) { DoNotOptimize(sample); });
+    Sample sample {1, 2.0};
+    double bare {NsPerRun(1u << 22, [&] { local.Invoke(sample); })};
+    SharedEventPublisher<void(Sample)> publisher;
+    publisher.Create(name);
+    publisher.Attach(local);
+    double published {NsPerRun(1u << 22, [&] { local.Invoke(sample); })};
+    SharedEventRing<Sample>::Remove(name);
+    std::printf("Invoke with 1 local subscriber: %.1f ns, with a publisher attached: %.1f ns\n\n", bare, published);
+
+    Latency shared {MeasureSharedMemory()};
+    Latency socket {MeasureSocket()};
+    std::printf("%-16s %10s %10s   (round trip, ns)\n", "bridge", "p50", "p99");
+    std::printf("%-16s %10.0f %10.0f\n", "shared memory", shared.p50, shared.p99);
+    std::printf("%-16s %10.0f %10.0f\n", "socketpair", socket.p50, socket.p99);
+}
@@ -0,0 +1,53 @@
+// Benchmark: subscribe + unsubscribe churn with string ids against subscription handles
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../Event.hpp"
+#include "Bench.hpp"
+
+struct Listener {
+    int total {0};
+
+    void OnValue(int value) {
+        total += value;
+    }
+};
+
+int main() {
+    // Long enough to not fit in the small string buffer, like most ids in real code
+    const std::string id {"Listener::OnValue subscription"};
+
+    std::printf("%-12s %24s %24s\n", "subscribers", "string id (ns/churn)", "handle (ns/churn)");
+    for (std::size_t subscribers : {16, 256, 4096}) {
+        std::vector<Listener> instances(subscribers);
+        std::size_t runs {(1u << 20) / subscribers};
+
+        Event<void(int)> idEvent;
+        for (auto& instance : instances) {
+            idEvent.Subscribe(id, &Listener::OnValue, &instance);
+        }
+        double byId {NsPerRun(runs, [&] {
+            for (auto& instance : instances) {
+                idEvent.Unsubscribe(id, &instance);
+                idEvent.Subscribe(id, &Listener::OnValue, &instance);
+            }
+        })};
+
+        Event<void(int)> handleEvent;
+        std::vector<SubscriptionHandle> handles;
+        for (auto& instance : instances) {
+            handles.push_back(handleEvent.Subscribe(&Listener::OnValue, &instance));
+        }
+        double byHandle {NsPerRun(runs, [&] {
+            for (std::size_t i = 0; i < instances.size(); ++i) {
+                handleEvent.Unsubscribe(handles[i]);
+                handles[i] = handleEvent.Subscribe(&Listener::OnValue, &instances[i]);
+            }
+        })};
+
+        std::printf("%-12zu %24.1f %24.1f\n", subscribers, byId / static_cast<double>(subscribers),
+                    byHandle / static_cast<double>(subscribers));
+    }
+}
@@ -0,0 +1,40 @@
+// Benchmark: cost of EVENT_TRACE on Invoke. Build it twice, with and without -DEVENT_TRACE, and compare.
+// Each traced handler reads steady_clock twice, so the overhead is mostly the cost of that clock on the machine.
+
+#include <cstdio>
+#include <vector>
+
+#include "../Event.hpp"
+#include "Bench.hpp"
+
+struct Listener {
+    int total {0};
+
+    void OnValue(int value) {
+        total += value;
+    }
+};
+
+int main() {
+#ifdef EVENT_TRACE
+    std::printf("EVENT_TRACE defined\n");
+#else
+    std::printf("EVENT_TRACE not defined\n");
+#endif
+    std::printf("%-12s %16s\n", "subscribers", "Invoke (ns)");
+    for (std::size_t subscribers : {1, 16, 256}) {
+        std::vector<Listener> listeners(subscribers);
+        Event<void(int)> event;
+        for (auto& listener : listeners) {
+            event.Subscribe<&Listener::OnValue>(&listener);
+        }
+        std::size_t runs {(1u << 22) / subscribers};
+        double ns {NsPerRun(runs, [&] { event.Invoke(1); })};
+        std::printf("%-12zu %16.1f\n", subscribers, ns);
+    }
+#ifdef EVENT_TRACE
+    EventTrace::Counters counters {EventTrace::Statistics()};
+    std::printf("invokes %llu, handlers called %llu, overwritten %llu\n", static_cast<unsigned long long>(counters.invokes),
+                static_cast<unsigned long long>(counters.handlersCalled), static_cast<unsigned long long>(counters.overwritten));
+#endif
+}
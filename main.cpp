@@ -5,7 +5,6 @@
 #include <iostream>
 
 #include "Event.hpp"
-// #include "No debug info/Event.hpp"
 
 class A {
    public:
@@ -34,6 +33,7 @@ class B {
     int health;
     A& a;
     int x;
+    ScopedConnection captureLambda; // Unsubscribes the lambda capturing this when B is destroyed
 
     B(const char* name, A& a) : name{name}, a{a} {
         // std::cout << "B was created\n";
@@ -50,7 +50,7 @@ class B {
     }
 
     B(Event<void(int)>& e, A& a) : a{a}, x{15} {
-        e.Subscribe("CaptureLambda", [this](int x) {
+        captureLambda = e.Subscribe("CaptureLambda", [this](int x) {
             std::cout << "Prev x = " << this->x << '\n';
             this->x = x;
             std::cout << "New x = " << this->x << '\n';
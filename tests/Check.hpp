@@ -0,0 +1,17 @@
+#ifndef __CHECK_H__
+#define __CHECK_H__
+
+#include <cstdio>
+#include <cstdlib>
+
+//* Assertion shared by the test programs in this folder. Unlike assert it is kept in release builds, and it prints
+//* the failed condition before exiting with EXIT_FAILURE.
+#define CHECK(condition)                                                              \
+    do {                                                                              \
+        if (!(condition)) {                                                           \
+            std::printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            std::exit(EXIT_FAILURE);                                                  \
+        }                                                                             \
+    } while (false)
+
+#endif // __CHECK_H__
@@ -0,0 +1,124 @@
+// Test program: CoalescedEvent. Checks that each flush raises the last coalesced arguments once, without a key and
+// per key, in the order they were first coalesced, that a full key table refuses new keys, and that arguments
+// coalesced by the handlers wait for the next flush.
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../CoalescedEvent.hpp"
+#include "Check.hpp"
+
+void TestLatestValue() {
+    CoalescedEvent<void(int)> onHealth;
+    std::vector<int> first;
+    std::vector<int> second;
+    onHealth.Subscribe([&](int health) { first.push_back(health); });
+    onHealth.Subscribe([&](int health) { second.push_back(health); });
+
+    for (int health = 100; health > 0; health -= 10) {
+        onHealth.Coalesce(health);
+    }
+    CHECK(first.empty() && onHealth.Pending() == 1);
+    CHECK(onHealth.Flush() == 1);
+    CHECK((first == std::vector<int>{10}));
+    CHECK((second == std::vector<int>{10}));
+    CHECK(onHealth.Coalesced() == 9);
+    CHECK(onHealth.Flush() == 0);
+
+    // Invoke still calls the subscribers right away
+    onHealth.Invoke(5);
+    CHECK(first.back() == 5 && onHealth.Pending() == 0);
+}
+
+void TestKeys() {
+    CoalescedEvent<void(int, const std::string&)> onMove {2};
+    CHECK(onMove.Capacity() == 2);
+    std::vector<std::string> calls;
+    onMove.Subscribe([&](int x, const std::string& name) { calls.push_back(name + std::to_string(x)); });
+
+    CHECK(onMove.Coalesce(EventKey{7}, 1, "b"));
+    CHECK(onMove.Coalesce(EventKey{3}, 1, "a"));
+    CHECK(onMove.Coalesce(EventKey{7}, 2, "b"));
+    CHECK(!onMove.Coalesce(EventKey{9}, 1, "c")); // Both slots are taken
+    onMove.Coalesce(0, "none");
+    CHECK(onMove.Coalesce(EventKey{3}, 3, "a"));
+    CHECK(onMove.Pending() == 3);
+    CHECK(onMove.Flush() == 3);
+    CHECK((calls == std::vector<std::string>{"b2", "a3", "none0"}));
+
+    // Keys are released by Flush
+    calls.clear();
+    CHECK(onMove.Coalesce(EventKey{9}, 4, "c"));
+    CHECK(onMove.Flush() == 1);
+    CHECK((calls == std::vector<std::string>{"c4"}));
+}
+
+void TestReentrancy() {
+    CoalescedEvent<void(int)> onValue;
+    std::vector<int> values;
+    onValue.Subscribe([&](int value) {
+        values.push_back(value);
+        if (value < 3) {
+            onValue.Coalesce(value + 1); // Waits for the next Flush
+            onValue.Coalesce(EventKey{1}, value + 10);
+        }
+    });
+    onValue.Coalesce(1);
+    CHECK(onValue.Flush() == 1);
+    CHECK((values == std::vector<int>{1}));
+    CHECK(onValue.Flush() == 2);
+    CHECK((values == std::vector<int>{1, 2, 11}));
+
+    // A Flush from a handler while flushing does nothing, and doesn't lose what the handler coalesces afterwards
+    CoalescedEvent<void(int)> onNested;
+    values.clear();
+    onNested.Subscribe([&](int value) {
+        values.push_back(value);
+        if (value == 1) {
+            CHECK(onNested.Flush() == 0);
+            onNested.Coalesce(EventKey{7}, 70);
+        }
+    });
+    onNested.Coalesce(1);
+    CHECK(onNested.Flush() == 1);
+    CHECK(onNested.Pending() == 1);
+    onNested.Coalesce(EventKey{7}, 72);
+    CHECK(onNested.Pending() == 1);
+    CHECK(onNested.Flush() == 1);
+    CHECK((values == std::vector<int>{1, 72}));
+    onNested.Coalesce(EventKey{7}, 74);
+    CHECK(onNested.Flush() == 1);
+    CHECK((values == std::vector<int>{1, 72, 74}));
+}
+
+void TestOwnership() {
+    // The only subscriber takes the pending copy, replaced copies are destroyed
+    CoalescedEvent<void(std::unique_ptr<int>)> onValue;
+    std::unique_ptr<int> taken;
+    onValue.Subscribe([&](std::unique_ptr<int> value) { taken = std::move(value); });
+    onValue.Coalesce(std::make_unique<int>(1));
+    onValue.Coalesce(std::make_unique<int>(2));
+    onValue.Flush();
+    CHECK(taken && *taken == 2);
+
+    auto shared {std::make_shared<int>(0)};
+    {
+        CoalescedEvent<void(std::shared_ptr<int>)> unflushed;
+        unflushed.Coalesce(shared);
+        unflushed.Coalesce(shared);
+        unflushed.Coalesce(EventKey{1}, shared);
+        CHECK(shared.use_count() == 3);
+    }
+    CHECK(shared.use_count() == 1);
+}
+
+int main() {
+    TestLatestValue();
+    TestKeys();
+    TestReentrancy();
+    TestOwnership();
+
+    std::printf("coalescing: all checks passed\n");
+}
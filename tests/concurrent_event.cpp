@@ -0,0 +1,71 @@
+// Test program: ConcurrentEvent. Readers raise the event while writers keep subscribing and destroying subscribers.
+// A subscriber is only destroyed after Unsubscribe + Synchronize, so a handler running on a destroyed object is a bug
+// (build with -fsanitize=address to catch it).
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../ConcurrentEvent.hpp"
+#include "Check.hpp"
+
+struct Counter {
+    std::atomic<std::uint64_t> calls {0};
+
+    void OnValue(int value) {
+        calls.fetch_add(static_cast<std::uint64_t>(value), std::memory_order_relaxed);
+    }
+};
+
+void TestSubscribeWhileRaising(unsigned readers, unsigned writers, std::chrono::milliseconds duration) {
+    ConcurrentEvent<void(int)> event;
+    Counter permanent;
+    event.Subscribe<&Counter::OnValue>("Permanent", &permanent);
+
+    std::atomic<bool> running {true};
+    std::atomic<std::uint64_t> invokes {0};
+    std::vector<std::thread> threads;
+
+    for (unsigned i = 0; i < readers; ++i) {
+        threads.emplace_back([&] {
+            std::uint64_t count {0};
+            while (running.load(std::memory_order_relaxed)) {
+                event.Invoke(1);
+                ++count;
+            }
+            invokes.fetch_add(count);
+        });
+    }
+    for (unsigned i = 0; i < writers; ++i) {
+        threads.emplace_back([&] {
+            while (running.load(std::memory_order_relaxed)) {
+                auto counter {std::make_unique<Counter>()};
+                SubscriptionHandle handle {event.Subscribe(&Counter::OnValue, counter.get())};
+                std::this_thread::yield();
+                event.Unsubscribe(handle);
+                event.Synchronize();
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(duration);
+    running = false;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Every Invoke called the permanent subscriber exactly once
+    CHECK(invokes.load() > 0);
+    CHECK(permanent.calls.load() == invokes.load());
+}
+
+int main() {
+    unsigned readers {std::max(4u, std::thread::hardware_concurrency())};
+    TestSubscribeWhileRaising(readers, 2, std::chrono::milliseconds{500});
+
+    std::printf("concurrent_event: all checks passed\n");
+}
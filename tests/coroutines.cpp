@@ -0,0 +1,269 @@
+// Test program: co_await on events (C++20). Checks what the coroutines receive, the order they are resumed in, and
+// that waiting coroutines can be destroyed, moved with their event or resumed through a scheduler.
+
+#include <coroutine>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../ConcurrentEvent.hpp"
+#include "../Event.hpp"
+#include "Check.hpp"
+
+//* Minimal coroutine type: starts right away and is destroyed with the Task, finished or not
+struct Task {
+    struct promise_type {
+        Task get_return_object() { return Task{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::abort(); }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle{handle} {}
+    Task(Task&& other) noexcept : handle{std::exchange(other.handle, nullptr)} {}
+    Task(const Task&) = delete;
+    Task& operator=(Task&& other) noexcept {
+        std::swap(handle, other.handle);
+        return *this;
+    }
+    ~Task() {
+        if (handle) {
+            handle.destroy();
+        }
+    }
+
+    bool Done() const { return handle.done(); }
+};
+
+//* Resumes the coroutines when Run is called instead of inside Invoke
+struct QueueScheduler : EventScheduler {
+    std::deque<std::coroutine_handle<>> queue;
+
+    void Schedule(std::coroutine_handle<> coroutine) override {
+        queue.push_back(coroutine);
+    }
+
+    void Run() {
+        while (!queue.empty()) {
+            auto coroutine {queue.front()};
+            queue.pop_front();
+            coroutine.resume();
+        }
+    }
+};
+
+std::vector<std::string> calls;
+
+Task WaitValue(Event<void(int)>& event, const char* name, int count) {
+    for (int i = 0; i < count; ++i) {
+        int value {co_await event};
+        calls.push_back(std::string{name} + std::to_string(value));
+    }
+}
+
+void TestValues() {
+    Event<void(int)> event;
+    event.Subscribe([](int value) { calls.push_back("handler" + std::to_string(value)); });
+    Task first {WaitValue(event, "first", 2)};
+    Task second {WaitValue(event, "second", 1)};
+    CHECK(calls.empty());
+
+    // Resumed after the subscribers, in the order they started waiting. A coroutine waiting again waits for the next Invoke.
+    event.Invoke(1);
+    CHECK((calls == std::vector<std::string>{"handler1", "first1", "second1"}));
+    CHECK(!first.Done() && second.Done());
+    calls.clear();
+    event.Invoke(2);
+    CHECK((calls == std::vector<std::string>{"handler2", "first2"}));
+    CHECK(first.Done());
+    calls.clear();
+    event.Invoke(3);
+    CHECK((calls == std::vector<std::string>{"handler3"}));
+    calls.clear();
+}
+
+Task WaitTuple(Event<void(const std::string&, int)>& event, std::string& name, int& value) {
+    auto [received, number] {co_await event};
+    name = received;
+    value = number;
+}
+
+Task WaitVoid(Event<void()>& event, int& count) {
+    co_await event;
+    ++count;
+    co_await event;
+    ++count;
+}
+
+void TestResults() {
+    Event<void(const std::string&, int)> named;
+    std::string name;
+    int value {0};
+    Task task {WaitTuple(named, name, value)};
+    named.Invoke("spawned", 7);
+    CHECK(name == "spawned" && value == 7);
+
+    Event<void()> tick;
+    int count {0};
+    Task ticks {WaitVoid(tick, count)};
+    tick();
+    tick();
+    tick();
+    CHECK(count == 2 && ticks.Done());
+}
+
+Task WaitCopy(Event<void(std::vector<int>)>& event, std::vector<int>& result) {
+    result = co_await event;
+}
+
+void TestMoveLast() {
+    // The waiter gets its copy before the last subscriber takes the arguments
+    Event<void(std::vector<int>)> event;
+    std::vector<int> kept;
+    event.Subscribe([&](std::vector<int> values) { kept = std::move(values); });
+    std::vector<int> result;
+    Task task {WaitCopy(event, result)};
+    event.InvokeMoveLast(std::vector<int>{1, 2, 3});
+    CHECK(result.size() == 3 && kept.size() == 3);
+}
+
+Task WaitAndRaise(Event<void(int)>& event) {
+    int value {co_await event};
+    calls.push_back("raised" + std::to_string(value));
+    event.Invoke(value + 1); // Doesn't resume this coroutine, which isn't waiting
+    value = co_await event;
+    calls.push_back("raised" + std::to_string(value));
+}
+
+void TestFromCoroutine() {
+    Event<void(int)> event;
+    Task task {WaitAndRaise(event)};
+    Task other {WaitValue(event, "other", 2)};
+    event.Invoke(1);
+    // other is resumed by the nested Invoke(2). Waiting again from there, it waits for the Invoke after Invoke(1).
+    CHECK((calls == std::vector<std::string>{"raised1", "other2"}));
+    calls.clear();
+    event.Invoke(5);
+    CHECK((calls == std::vector<std::string>{"other5", "raised5"}));
+    CHECK(task.Done() && other.Done());
+    calls.clear();
+}
+
+void TestDestroy() {
+    Event<void(int)> event;
+    {
+        Task first {WaitValue(event, "first", 1)};
+        Task second {WaitValue(event, "second", 1)};
+        Task third {WaitValue(event, "third", 1)};
+        // Destroying waiting coroutines removes them from the event
+        second = Task{WaitValue(event, "replaced", 1)};
+        event.Invoke(1);
+        CHECK((calls == std::vector<std::string>{"first1", "third1", "replaced1"}));
+        calls.clear();
+        Task waiting {WaitValue(event, "waiting", 1)};
+    }
+    event.Invoke(2);
+    CHECK(calls.empty());
+
+    // A coroutine can destroy another one waiting on the same Invoke
+    Task* victim {nullptr};
+    auto killer {[&](Event<void(int)>& event) -> Task {
+        co_await event;
+        victim->handle.destroy();
+        victim->handle = nullptr;
+        calls.push_back("killed");
+    }};
+    Task first {killer(event)};
+    Task second {WaitValue(event, "victim", 1)};
+    victim = &second;
+    event.Invoke(3);
+    CHECK((calls == std::vector<std::string>{"killed"}));
+    calls.clear();
+
+    // Destroying the event leaves its waiters suspended, they can still be destroyed
+    auto dying {std::make_unique<Event<void(int)>>()};
+    Task orphan {WaitValue(*dying, "orphan", 1)};
+    dying.reset();
+    CHECK(!orphan.Done());
+}
+
+void TestMove() {
+    Event<void(int)> event;
+    Task task {WaitValue(event, "moved", 1)};
+    Event<void(int)> moved {std::move(event)};
+    event.Invoke(1);
+    CHECK(calls.empty());
+    Event<void(int)> assigned;
+    assigned = std::move(moved);
+    assigned.Invoke(2);
+    CHECK((calls == std::vector<std::string>{"moved2"}));
+    calls.clear();
+
+    // Copies don't take the waiters
+    Task other {WaitValue(assigned, "original", 1)};
+    Event<void(int)> copy {assigned};
+    copy.Invoke(3);
+    CHECK(calls.empty());
+    assigned.Invoke(4);
+    CHECK((calls == std::vector<std::string>{"original4"}));
+    calls.clear();
+}
+
+Task WaitScheduled(Event<void(std::string)>& event, EventScheduler& scheduler, std::string& result) {
+    result = co_await event.Next(scheduler);
+}
+
+void TestScheduler() {
+    Event<void(std::string)> event;
+    QueueScheduler scheduler;
+    std::string result;
+    Task task {WaitScheduled(event, scheduler, result)};
+    std::string payload {"payload"};
+    event.Invoke(payload);
+    payload = "changed"; // The arguments were copied before Invoke returned
+    CHECK(result.empty() && scheduler.queue.size() == 1);
+    scheduler.Run();
+    CHECK(result == "payload" && task.Done());
+}
+
+Task WaitThreaded(Event<void(int), EventPolicy<NoLogging, MutexThreaded>>& event, EventScheduler& scheduler, int& total) {
+    for (int i = 0; i < 3; ++i) {
+        total += co_await event.Next(scheduler);
+    }
+}
+
+void TestThreads() {
+    // Raised from another thread, resumed on this one
+    Event<void(int), EventPolicy<NoLogging, MutexThreaded>> event;
+    QueueScheduler scheduler;
+    int total {0};
+    Task task {WaitThreaded(event, scheduler, total)};
+    for (int value = 1; value <= 3; ++value) {
+        std::thread raiser {[&] { event.Invoke(value); }};
+        raiser.join();
+        scheduler.Run();
+    }
+    CHECK(total == 6 && task.Done());
+}
+
+int main() {
+    TestValues();
+    TestResults();
+    TestMoveLast();
+    TestFromCoroutine();
+    TestDestroy();
+    TestMove();
+    TestScheduler();
+    TestThreads();
+
+    std::printf("coroutines: all checks passed\n");
+}
@@ -0,0 +1,142 @@
+// Test program: the groups of subscriptions of the same member function are allocated like the rest of the
+// subscriber storage. Counts the global allocations of mass subscriptions to a PmrEvent backed by an arena, and
+// checks that moving an event into one with another memory resource moves its groups too.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#include "../Event.hpp"
+#include "Check.hpp"
+
+static std::atomic<std::size_t> globalAllocations {0};
+
+void* operator new(std::size_t size) {
+    ++globalAllocations;
+    if (void* memory {std::malloc(size == 0 ? 1 : size)}) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+// GCC pairs the new expressions it inlines with the free below and warns, though both ends are replaced here
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+//* Memory resource counting the blocks it has handed out and not yet got back
+class CountingResource : public std::pmr::memory_resource {
+public:
+    std::size_t live {0};
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++live;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* memory, std::size_t bytes, std::size_t alignment) override {
+        --live;
+        std::pmr::new_delete_resource()->deallocate(memory, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+struct Unit {
+    static inline long long total {0};
+
+    int id {0};
+
+    void OnValue(int value) {
+        total += id * value;
+    }
+
+    void OnOther(int value) {
+        total += value;
+    }
+
+    static void Handle(Span<Unit*> units, int value) {
+        total += static_cast<long long>(units.size()) * value;
+    }
+};
+
+void TestArena() {
+    constexpr int count {1000};
+    std::vector<Unit> units(count);
+    for (int i = 0; i < count; ++i) {
+        units[i].id = i + 1;
+    }
+    // Everything has to fit in the buffer, the arena can't fall back to the global heap
+    static std::byte buffer[1 << 23];
+    std::pmr::monotonic_buffer_resource arena {buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+
+    {
+        PmrEvent<void(int)> event {&arena};
+        // The anchor of the connections is shared with them, it is the only allocation from the global heap
+        event.Subscribe([](int) {});
+        std::size_t before {globalAllocations};
+        for (auto& unit : units) {
+            event.Subscribe<&Unit::OnValue>(&unit);
+            event.Subscribe(&Unit::OnOther, &unit);
+            event.Subscribe<&Unit::Handle>(&unit);
+        }
+        Unit::total = 0;
+        event.Invoke(1);
+        CHECK(Unit::total == count * (count + 1) / 2 + count + count);
+
+        for (int i = 0; i < count; i += 3) {
+            event.RemoveListener(&units[i]);
+        }
+        event.Invoke(0);
+        CHECK(globalAllocations == before);
+    }
+}
+
+void TestMoveToOtherResource() {
+    std::vector<Unit> units(64);
+    CountingResource first;
+    CountingResource second;
+    {
+        PmrEvent<void(int)> target {&second};
+        {
+            PmrEvent<void(int)> source {&first};
+            for (auto& unit : units) {
+                unit.id = 1;
+                source.Subscribe<&Unit::OnValue>(&unit);
+                source.Subscribe<&Unit::Handle>(&unit);
+            }
+            target = std::move(source);
+        }
+        // Nothing of the destroyed event is left in its resource, the groups were copied into the other one
+        CHECK(first.live == 0);
+        Unit::total = 0;
+        target.Invoke(1);
+        CHECK(Unit::total == 128);
+    }
+    CHECK(second.live == 0);
+}
+
+int main() {
+    TestArena();
+    TestMoveToOtherResource();
+
+    std::printf("group_allocation: all checks passed\n");
+}
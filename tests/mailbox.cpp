@@ -0,0 +1,153 @@
+// Test program: MailboxEvent. Checks the order of the pumped raises, each overflow mode, that nothing posted by
+// several threads is lost or reordered per thread, and that the arguments left in the ring are destroyed.
+
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../MailboxEvent.hpp"
+#include "Check.hpp"
+
+void TestOrder() {
+    MailboxEvent<void(int, const std::string&)> mailbox {8};
+    CHECK(mailbox.Capacity() == 8);
+    std::vector<std::string> calls;
+    mailbox.Subscribe([&](int value, const std::string& name) {
+        calls.push_back(name + std::to_string(value));
+        if (value == 1) {
+            mailbox.Post(3, "handler"); // Waits for the next Pump
+        }
+    });
+
+    std::string name {"posted"};
+    mailbox.Post(1, name);
+    name = "changed"; // The mailbox keeps its own copy
+    mailbox.Post(2, name);
+    CHECK(calls.empty() && mailbox.Pending() == 2);
+    CHECK(mailbox.Pump() == 2);
+    CHECK((calls == std::vector<std::string>{"posted1", "changed2"}));
+    CHECK(mailbox.Pending() == 1);
+    CHECK(mailbox.Pump() == 1);
+    CHECK(calls.back() == "handler3");
+    CHECK(mailbox.Pump() == 0);
+}
+
+void TestOverflow() {
+    std::vector<int> values;
+    auto record {[&](int value) { values.push_back(value); }};
+
+    MailboxEvent<void(int)> newest {4, MailboxOverflow::DropNewest};
+    newest.Subscribe(record);
+    for (int i = 0; i < 6; ++i) {
+        CHECK(newest.Post(i) == (i < 4));
+    }
+    CHECK(newest.Dropped() == 2);
+    newest.Pump();
+    CHECK((values == std::vector<int>{0, 1, 2, 3}));
+    values.clear();
+
+    MailboxEvent<void(int)> oldest {4, MailboxOverflow::DropOldest};
+    oldest.Subscribe(record);
+    for (int i = 0; i < 6; ++i) {
+        CHECK(oldest.Post(i));
+    }
+    CHECK(oldest.Dropped() == 2);
+    oldest.Pump();
+    CHECK((values == std::vector<int>{2, 3, 4, 5}));
+    values.clear();
+
+    // A blocked producer continues once the owner pumps
+    MailboxEvent<void(int)> blocking {2, MailboxOverflow::Block};
+    blocking.Subscribe(record);
+    blocking.Post(0);
+    blocking.Post(1);
+    std::atomic<bool> posted {false};
+    std::thread producer {[&] {
+        blocking.Post(2);
+        posted = true;
+    }};
+    while (values.size() < 3) {
+        blocking.Pump();
+        std::this_thread::yield();
+    }
+    producer.join();
+    CHECK(posted && blocking.Dropped() == 0);
+    CHECK((values == std::vector<int>{0, 1, 2}));
+}
+
+void TestOwnership() {
+    // Move-only arguments: the only subscriber takes the mailbox copy
+    MailboxEvent<void(std::unique_ptr<int>)> mailbox;
+    std::unique_ptr<int> taken;
+    mailbox.Subscribe([&](std::unique_ptr<int> value) { taken = std::move(value); });
+    mailbox.Post(std::make_unique<int>(5));
+    mailbox.Pump();
+    CHECK(taken && *taken == 5);
+
+    // Arguments never pumped or dropped are destroyed
+    auto shared {std::make_shared<int>(1)};
+    {
+        MailboxEvent<void(std::shared_ptr<int>)> unpumped {4, MailboxOverflow::DropOldest};
+        for (int i = 0; i < 6; ++i) {
+            unpumped.Post(shared);
+        }
+        CHECK(shared.use_count() == 5);
+    }
+    CHECK(shared.use_count() == 1);
+}
+
+//* Producers post (producer, sequence) while the owner pumps; every raise must arrive once, in order per producer
+void TestProducers(MailboxOverflow overflow) {
+    constexpr int Producers {4};
+    constexpr int Posts {20000};
+    MailboxEvent<void(int, int)> mailbox {64, overflow};
+    std::vector<int> next(Producers, 0);
+    std::size_t received {0};
+    bool ordered {true};
+    mailbox.Subscribe([&](int producer, int sequence) {
+        ordered = ordered && sequence >= next[producer];
+        next[producer] = sequence + 1;
+        ++received;
+    });
+
+    std::atomic<int> running {Producers};
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < Producers; ++producer) {
+        threads.emplace_back([&, producer] {
+            for (int sequence = 0; sequence < Posts; ++sequence) {
+                mailbox.Post(producer, sequence);
+            }
+            --running;
+        });
+    }
+    while (running > 0) {
+        mailbox.Pump();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    mailbox.Pump();
+
+    CHECK(ordered);
+    CHECK(received + mailbox.Dropped() == static_cast<std::size_t>(Producers * Posts));
+    if (overflow == MailboxOverflow::Block) {
+        CHECK(received == static_cast<std::size_t>(Producers * Posts));
+        for (int count : next) {
+            CHECK(count == Posts);
+        }
+    }
+}
+
+int main() {
+    TestOrder();
+    TestOverflow();
+    TestOwnership();
+    TestProducers(MailboxOverflow::Block);
+    TestProducers(MailboxOverflow::DropOldest);
+    TestProducers(MailboxOverflow::DropNewest);
+
+    std::printf("mailbox: all checks passed\n");
+}
@@ -0,0 +1,333 @@
+// Test program: subscriptions of the same member function are grouped into one delegate. Checks that grouping keeps
+// the call order, that members can be removed and added at any time, including from a handler, and the batch
+// handlers taking every instance at once, and noexcept member functions.
+
+#include <cstdio>
+#include <vector>
+
+#include "../ConcurrentEvent.hpp"
+#include "../Event.hpp"
+#include "Check.hpp"
+
+std::vector<int> calls;
+
+void Expect(std::vector<int> expected) {
+    CHECK(calls == expected);
+    calls.clear();
+}
+
+struct Unit {
+    int id {0};
+
+    void OnValue(int value) {
+        calls.push_back(id + value);
+    }
+
+    void OnOther(int value) {
+        calls.push_back(100 + id + value);
+    }
+
+    void OnConst(int value) const {
+        calls.push_back(200 + id + value);
+    }
+
+    void OnNoexcept(int value) noexcept {
+        calls.push_back(300 + id + value);
+    }
+
+    void OnConstNoexcept(int value) const noexcept {
+        calls.push_back(400 + id + value);
+    }
+
+    static void Handle(Span<Unit*> units, int value) {
+        calls.push_back(-static_cast<int>(units.size()));
+        for (Unit* unit : units) {
+            calls.push_back(unit->id + value);
+        }
+    }
+};
+
+std::vector<Unit> MakeUnits(int count) {
+    std::vector<Unit> units(count);
+    for (int i = 0; i < count; ++i) {
+        units[i].id = i + 1;
+    }
+    return units;
+}
+
+template <class EventType>
+void TestOrder() {
+    auto units {MakeUnits(4)};
+    EventType event;
+    event.template Subscribe<&Unit::OnValue>(&units[0]);
+    event.template Subscribe<&Unit::OnValue>(&units[1]);
+    event.Subscribe([](int value) { calls.push_back(50 + value); });
+    event.template Subscribe<&Unit::OnValue>(&units[2]);
+    event.template Subscribe<&Unit::OnValue>(&units[3], 1);
+    event.template Subscribe<&Unit::OnOther>(&units[0]);
+    event.Subscribe(&Unit::OnOther, &units[1]);
+    event.Subscribe(&Unit::OnOther, &units[2]);
+    event.Subscribe(&Unit::OnValue, &units[3]);
+    event.Subscribe(&Unit::OnConst, static_cast<const Unit*>(&units[0]));
+    event.Subscribe(&Unit::OnConst, static_cast<const Unit*>(&units[1]));
+    event.template Subscribe<&Unit::OnValue>(EventKey{7}, &units[0]);
+    event.template Subscribe<&Unit::OnValue>(&units[1]);
+
+    // Same order as one delegate per subscription: priority first, then subscription order
+    event.Invoke(0);
+    Expect({4, 1, 2, 50, 3, 101, 102, 103, 4, 201, 202, 1, 2});
+    event.Invoke(EventKey{7}, 0);
+    Expect({1});
+}
+
+void TestRemove() {
+    auto units {MakeUnits(5)};
+    Event<void(int)> event;
+    std::vector<Connection> connections;
+    for (auto& unit : units) {
+        connections.push_back(event.Subscribe<&Unit::OnValue>(&unit));
+    }
+    event.Subscribe("other", &Unit::OnOther, &units[0]);
+    event.Subscribe("value", &Unit::OnValue, &units[4]);
+    event.Subscribe(&Unit::OnValue, &units[3]);
+
+    connections[1].Disconnect();
+    event.Unsubscribe(connections[3]);
+    CHECK(!event.IsSubscribed(connections[1]) && event.IsSubscribed(connections[2]));
+    event.Invoke(0);
+    Expect({1, 3, 5, 101, 5, 4});
+
+    // Removing an instance subscribed to several functions, then adding one back at the end of its group
+    event.RemoveListener(&units[4]);
+    event.Subscribe(&Unit::OnValue, &units[1]);
+    event.Invoke(0);
+    Expect({1, 3, 101, 4, 2});
+
+    // Replacing a grouped subscription with an id moves it like any other
+    event.Subscribe("value", &Unit::OnValue, &units[2]);
+    event.Subscribe("value", &Unit::OnValue, &units[2], 1);
+    event.Invoke(0);
+    Expect({3, 1, 3, 101, 4, 2});
+
+    for (auto& unit : units) {
+        event.RemoveListener(&unit);
+    }
+    event.Invoke(0);
+    Expect({});
+    event.Subscribe<&Unit::OnValue>(&units[0]);
+    event.Invoke(0);
+    Expect({1});
+}
+
+struct Remover {
+    int id;
+    std::vector<Connection>* connections;
+    Event<void(int)>* event;
+
+    void OnValue(int value) {
+        calls.push_back(id);
+        if (value == 1 && id == 1) {
+            (*connections)[2].Disconnect();               // Later instance of the same group, not called
+            (*connections)[0].Disconnect();               // Itself
+            event->Subscribe<&Remover::OnValue>(this);    // Joins the group once the event returns
+        }
+    }
+};
+
+void TestFromHandler() {
+    Event<void(int)> event;
+    std::vector<Connection> connections;
+    Remover removers[4] {{1, &connections, &event}, {2, &connections, &event}, {3, &connections, &event}, {4, &connections, &event}};
+    for (auto& remover : removers) {
+        connections.push_back(event.Subscribe<&Remover::OnValue>(&remover));
+    }
+    event.Invoke(1);
+    Expect({1, 2, 4});
+    event.Invoke(0);
+    Expect({2, 4, 1});
+}
+
+struct Raiser {
+    Event<void(int)>* event;
+    Connection* last;
+
+    void OnValue(int value) {
+        calls.push_back(value);
+        if (value == 0) {
+            event->Invoke(1);
+            last->Disconnect();
+        }
+    }
+};
+
+void TestNested() {
+    auto units {MakeUnits(3)};
+    Event<void(int)> event;
+    Connection last;
+    Raiser raisers[2] {{&event, &last}, {&event, &last}};
+    event.Subscribe<&Raiser::OnValue>(&raisers[0]);
+    event.Subscribe<&Raiser::OnValue>(&raisers[1]);
+    last = event.Subscribe<&Unit::OnValue>(&units[0]);
+    event.Invoke(0);
+    // Both raisers raise the event again, the first nested Invoke still calls the last subscriber
+    Expect({0, 1, 1, 2, 0, 1, 1});
+    event.Invoke(5);
+    Expect({5, 5});
+}
+
+void TestBatch() {
+    auto units {MakeUnits(4)};
+    Event<void(int)> event;
+    std::vector<Connection> connections;
+    for (auto& unit : units) {
+        connections.push_back(event.Subscribe<&Unit::Handle>(&unit));
+    }
+    event.Invoke(10);
+    Expect({-4, 11, 12, 13, 14});
+
+    // Another subscription in between starts a new batch, a higher priority one goes first
+    event.Subscribe<&Unit::OnValue>(&units[0]);
+    event.Subscribe<&Unit::Handle>(&units[1]);
+    event.Subscribe<&Unit::Handle>(&units[2], 1);
+    event.Invoke(0);
+    Expect({-1, 3, -4, 1, 2, 3, 4, 1, -1, 2});
+
+    // Removed instances leave the span right away, and the batch once it is empty
+    connections[0].Disconnect();
+    connections[2].Disconnect();
+    event.RemoveListener(&units[2]);
+    event.Invoke(0);
+    Expect({-2, 2, 4, 1, -1, 2});
+    event.RemoveListener(&units[1]);
+    event.RemoveListener(&units[3]);
+    event.Invoke(0);
+    Expect({1});
+
+    // Ids work as with other member functions
+    event.Subscribe<&Unit::Handle>("batch", &units[1]);
+    event.Subscribe<&Unit::Handle>("batch", &units[1], 1);
+    event.Invoke(0);
+    Expect({-1, 2, 1});
+}
+
+struct Checker {
+    int id;
+
+    static void Handle(Span<Checker*> checkers, int) {
+        calls.push_back(-static_cast<int>(checkers.size()));
+        for (Checker* checker : checkers) {
+            calls.push_back(checker ? checker->id : 0);
+        }
+    }
+};
+
+void TestBatchFromHandler() {
+    Checker checkers[4] {{1}, {2}, {3}, {4}};
+    Event<void(int)> event;
+    Connection middle;
+    event.Subscribe([&](int) {
+        middle.Disconnect();
+        event.Subscribe<&Checker::Handle>(&checkers[3]);
+    }, 1);
+    event.Subscribe<&Checker::Handle>(&checkers[0]);
+    middle = event.Subscribe<&Checker::Handle>(&checkers[1]);
+    event.Subscribe<&Checker::Handle>(&checkers[2]);
+
+    // While the event is raised a removed instance is nullptr in the span, and added ones wait for the next Invoke
+    event.Invoke(0);
+    Expect({-3, 1, 0, 3});
+    event.Invoke(0);
+    Expect({-3, 1, 3, 4});
+}
+
+//* Payload counting its copies. A moved-from payload has no values.
+struct Counted {
+    static inline int copies {0};
+
+    std::vector<int> values;
+
+    Counted() : values(2, 1) {}
+    Counted(const Counted& other) : values{other.values} { ++copies; }
+    Counted(Counted&&) noexcept = default;
+};
+
+struct Taker {
+    std::vector<Counted> kept;
+
+    void Keep(Counted value) {
+        CHECK(value.values.size() == 2);
+        kept.push_back(std::move(value));
+    }
+};
+
+void TestMoveLast() {
+    Taker takers[3];
+    Event<void(Counted)> event;
+    for (auto& taker : takers) {
+        taker.kept.reserve(2);
+        event.Subscribe<&Taker::Keep>(&taker);
+    }
+    // Grouped subscribers share the arguments like separate ones: a copy each, the last one takes them
+    event.Invoke(Counted{});
+    CHECK(Counted::copies == 3);
+    Counted::copies = 0;
+    event.InvokeMoveLast(Counted{});
+    CHECK(Counted::copies == 2);
+    CHECK(takers[2].kept.size() == 2 && takers[2].kept.back().values.size() == 2);
+}
+
+void TestNoexcept() {
+    auto units {MakeUnits(3)};
+    Event<void(int)> event;
+    event.Subscribe<&Unit::OnNoexcept>(&units[0]);
+    event.Subscribe<&Unit::OnNoexcept>(&units[1]);
+    event.Subscribe<&Unit::OnConstNoexcept>(static_cast<const Unit*>(&units[0]));
+    event.Subscribe<&Unit::OnConstNoexcept>(static_cast<const Unit*>(&units[1]));
+    event.Subscribe(&Unit::OnNoexcept, &units[2]);
+    event.Subscribe<&Unit::OnNoexcept>(EventKey{7}, &units[2]);
+    event.Invoke(0);
+    Expect({301, 302, 401, 402, 303, 303});
+    event.Invoke(EventKey{7}, 0);
+    Expect({303});
+
+    event.RemoveListener(&units[0]);
+    event.RemoveListener(static_cast<const Unit*>(&units[1]));
+    event.Invoke(0);
+    Expect({302, 401, 303, 303});
+}
+
+void TestCopy() {
+    auto units {MakeUnits(3)};
+    Event<void(int)> event;
+    Connection first {event.Subscribe<&Unit::OnValue>(&units[0])};
+    event.Subscribe<&Unit::OnValue>(&units[1]);
+    event.Subscribe<&Unit::Handle>(&units[2]);
+
+    Event<void(int)> copy {event};
+    copy.Unsubscribe(first);
+    copy.Subscribe<&Unit::OnValue>(&units[2]);
+    event.Invoke(0);
+    Expect({1, 2, -1, 3});
+    copy.Invoke(0);
+    Expect({2, -1, 3, 3});
+
+    event = std::move(copy);
+    event.Invoke(0);
+    Expect({2, -1, 3, 3});
+}
+
+int main() {
+    TestOrder<Event<void(int)>>();
+    TestOrder<Event<void(int), EventPolicy<NoLogging, LockFreeThreaded>>>();
+    TestOrder<Event<void(int), EventPolicy<NoLogging, MutexThreaded>>>();
+    TestRemove();
+    TestFromHandler();
+    TestNested();
+    TestBatch();
+    TestBatchFromHandler();
+    TestMoveLast();
+    TestNoexcept();
+    TestCopy();
+
+    std::printf("method_groups: all checks passed\n");
+}
@@ -0,0 +1,135 @@
+// Test program: InvokeParallel. Checks that the subscribers are spread over the chunks even when subscriptions of the
+// same member function are grouped into one delegate, and that every subscriber is called exactly once.
+
+#include <atomic>
+#include <cstdio>
+#include <vector>
+
+#include "../ThreadPool.hpp"
+#include "Check.hpp"
+
+//* Runs the chunks one after the other, recording how the work was split
+class CountingExecutor : public EventExecutor {
+public:
+    std::size_t concurrency;
+    std::size_t chunks {0};
+
+    explicit CountingExecutor(std::size_t concurrency) : concurrency{concurrency} {}
+
+    std::size_t Concurrency() const override {
+        return concurrency;
+    }
+
+    void ParallelFor(std::size_t count, const Delegate<void(std::size_t)>& task) override {
+        chunks = count;
+        for (std::size_t i = 0; i < count; ++i) {
+            task(i);
+        }
+    }
+};
+
+struct Agent {
+    std::atomic<int> ticks {0};
+
+    void OnTick(const float&) {
+        ++ticks;
+    }
+
+    void OnOtherTick(const float&) {
+        ticks += 100;
+    }
+
+    static void Handle(Span<Agent*> agents, const float&) {
+        for (Agent* agent : agents) {
+            agent->ticks += 10000;
+        }
+    }
+};
+
+template <class Check>
+void ExpectTicks(std::vector<Agent>& agents, Check&& expected) {
+    for (std::size_t i = 0; i < agents.size(); ++i) {
+        CHECK(agents[i].ticks == expected(i));
+        agents[i].ticks = 0;
+    }
+}
+
+void TestGroupIsSplit() {
+    constexpr std::size_t Subscribers {16384};
+    std::vector<Agent> agents(Subscribers);
+    Event<void(const float&)> tick;
+    for (auto& agent : agents) {
+        tick.Subscribe<&Agent::OnTick>(&agent);
+    }
+
+    CountingExecutor executor {8};
+    tick.InvokeParallel(executor, 0.016f);
+    CHECK(executor.chunks == 32);
+    ExpectTicks(agents, [](std::size_t) { return 1; });
+
+    // Removed instances keep their place in the group until it is compacted
+    for (std::size_t i = 0; i < Subscribers; i += 7) {
+        tick.RemoveListener(&agents[i]);
+    }
+    tick.InvokeParallel(executor, 0.016f);
+    CHECK(executor.chunks > 1);
+    ExpectTicks(agents, [](std::size_t i) { return i % 7 == 0 ? 0 : 1; });
+
+    ThreadPool pool {3};
+    tick.InvokeParallel(pool, 0.016f);
+    ExpectTicks(agents, [](std::size_t i) { return i % 7 == 0 ? 0 : 1; });
+}
+
+void TestMixed() {
+    // Groups of several member functions and batch handlers, separated by a lambda and priorities
+    std::vector<Agent> agents(1000);
+    Event<void(const float&)> tick;
+    std::atomic<int> lambdaCalls {0};
+    for (std::size_t i = 0; i < 300; ++i) {
+        tick.Subscribe<&Agent::OnTick>(&agents[i]);
+    }
+    tick.Subscribe([&](const float&) { ++lambdaCalls; });
+    for (std::size_t i = 300; i < 600; ++i) {
+        tick.Subscribe(&Agent::OnOtherTick, &agents[i]);
+    }
+    for (std::size_t i = 600; i < 1000; ++i) {
+        tick.Subscribe<&Agent::Handle>(&agents[i], i < 800 ? 1 : 0);
+    }
+
+    // 1001 subscribers in 4 chunks per thread, of at least 16 subscribers
+    const std::size_t expected[][2] {{1, 4}, {3, 12}, {8, 32}, {64, 63}};
+    for (auto [concurrency, chunks] : expected) {
+        CountingExecutor executor {concurrency};
+        tick.InvokeParallel(executor, 0.016f);
+        CHECK(executor.chunks == chunks);
+        CHECK(lambdaCalls == 1);
+        lambdaCalls = 0;
+        ExpectTicks(agents, [](std::size_t i) { return i < 300 ? 1 : i < 600 ? 100 : 10000; });
+    }
+}
+
+void TestInlineExecutor() {
+    // An executor running the tasks on the calling thread may report no concurrency at all
+    std::vector<Agent> agents(100);
+    Event<void(const float&)> tick;
+    for (auto& agent : agents) {
+        tick.Subscribe<&Agent::OnTick>(&agent);
+    }
+
+    CountingExecutor executor {0};
+    tick.InvokeParallel(executor, 0.016f);
+    CHECK(executor.chunks == 4);
+    ExpectTicks(agents, [](std::size_t) { return 1; });
+
+    Event<void(const float&)> empty;
+    empty.InvokeParallel(executor, 0.016f);
+    CHECK(executor.chunks == 0);
+}
+
+int main() {
+    TestGroupIsSplit();
+    TestMixed();
+    TestInlineExecutor();
+
+    std::printf("parallel_fanout: all checks passed\n");
+}
@@ -0,0 +1,100 @@
+// Test program: QueuedEvent. Checks the order of the flushed calls, handlers unsubscribing, enqueuing and
+// flushing while the queue is being flushed, and threads enqueuing while another one flushes.
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "../ConcurrentEvent.hpp"
+#include "../QueuedEvent.hpp"
+#include "Check.hpp"
+
+void TestOrder() {
+    QueuedEvent<void(int)> event;
+    std::vector<int> calls;
+    event.Subscribe([&](int value) { calls.push_back(value); });
+    event.Subscribe([&](int value) { calls.push_back(10 + value); });
+    event.SubscribeBatch([&](QueuedEvent<void(int)>::Batch batch) { calls.push_back(-static_cast<int>(batch.size())); });
+
+    event.Enqueue(1);
+    event.Enqueue(2);
+    CHECK(calls.empty() && event.Pending() == 2);
+    event.Flush();
+    CHECK((calls == std::vector<int>{1, 2, 11, 12, -2}));
+    CHECK(event.Pending() == 0);
+}
+
+void TestUnsubscribeWhileFlushing() {
+    QueuedEvent<void(int)> event;
+    std::vector<int> calls;
+    Connection self;
+    self = event.Subscribe([&](int value) {
+        calls.push_back(value);
+        self.Disconnect();
+    });
+    event.Subscribe([&](int value) { calls.push_back(10 + value); });
+
+    event.Enqueue(1);
+    event.Enqueue(2);
+    event.Flush();
+    CHECK((calls == std::vector<int>{1, 11, 12}));
+}
+
+void TestFlushWhileFlushing() {
+    QueuedEvent<void(int)> event;
+    std::vector<int> calls;
+    event.Subscribe([&](int value) {
+        calls.push_back(value);
+        if (value < 10) {
+            event.Enqueue(value + 10); // Waits for the next Flush
+        }
+        event.Flush();
+    });
+
+    event.Enqueue(1);
+    event.Enqueue(2);
+    event.Flush();
+    CHECK((calls == std::vector<int>{1, 2}));
+    CHECK(event.Pending() == 2);
+    event.Flush();
+    CHECK((calls == std::vector<int>{1, 2, 11, 12}));
+    CHECK(event.Pending() == 0);
+}
+
+void TestEnqueueFromThreads() {
+    constexpr int threads {4};
+    constexpr int raises {20000};
+    QueuedEvent<void(int), EventPolicy<NoLogging, MutexThreaded>> event;
+    long long total {0};
+    event.Subscribe([&](int value) { total += value; });
+
+    std::atomic<int> running {threads};
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threads; ++t) {
+        producers.emplace_back([&] {
+            for (int i = 0; i < raises; ++i) {
+                event.Enqueue(1);
+            }
+            --running;
+        });
+    }
+    while (running > 0) {
+        event.Flush();
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    event.Flush();
+    CHECK(total == static_cast<long long>(threads) * raises);
+    CHECK(event.Pending() == 0);
+}
+
+int main() {
+    TestOrder();
+    TestUnsubscribeWhileFlushing();
+    TestFlushWhileFlushing();
+    TestEnqueueFromThreads();
+
+    std::printf("queued_event: all checks passed\n");
+}
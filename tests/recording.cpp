@@ -0,0 +1,115 @@
+// Test program: EventRecorder and EventReplayer. Checks that the raises of several events are replayed into the
+// right events in the order they were recorded, that paced replay keeps the recorded gaps, that records still
+// buffered are written on destruction, and that a recording of other arguments can't be opened.
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "../EventRecording.hpp"
+#include "Check.hpp"
+
+struct Hit {
+    int target;
+    float damage;
+};
+
+//* Unique per run, so that parallel test runs don't share a file
+std::string RecordingPath(const char* suffix) {
+    return "event_system_recording_" + std::to_string(getpid()) + "_" + suffix + ".bin";
+}
+
+void TestReplay() {
+    std::string path {RecordingPath("order")};
+    {
+        Event<void(int, Hit)> onHit;
+        Event<void(int, Hit)> onHeal;
+        EventRecorder<void(int, Hit)> recorder;
+        CHECK(recorder.Create(path, 3)); // Small buffer, so it is written several times
+        recorder.Attach(onHit);
+        recorder.Attach(onHeal);
+        for (int i = 0; i < 10; ++i) {
+            (i % 3 == 0 ? onHeal : onHit).Invoke(i, Hit{i * 2, i * 0.5f});
+        }
+        CHECK(recorder.Recorded() == 10);
+    } // The last raise is still buffered, written by the destructor
+
+    Event<void(int, Hit)> hits;
+    Event<void(int, Hit)> heals;
+    std::vector<int> order;
+    bool valid {true};
+    hits.Subscribe([&](int i, Hit hit) {
+        order.push_back(i);
+        valid = valid && i % 3 != 0 && hit.target == i * 2 && hit.damage == i * 0.5f;
+    });
+    heals.Subscribe([&](int i, Hit) {
+        order.push_back(-i);
+        valid = valid && i % 3 == 0;
+    });
+
+    EventReplayer<void(int, Hit)> replayer;
+    CHECK(replayer.Open(path));
+    CHECK(replayer.Size() == 10);
+    replayer.Target(0, hits);
+    replayer.Target(1, heals);
+    CHECK(replayer.Replay() == 10);
+    CHECK(valid);
+    CHECK((order == std::vector<int>{0, 1, 2, -3, 4, 5, -6, 7, 8, -9}));
+
+    // Only the streams with a target are raised
+    EventReplayer<void(int, Hit)> healsOnly;
+    CHECK(healsOnly.Open(path));
+    healsOnly.Target(1, heals);
+    order.clear();
+    healsOnly.Replay();
+    CHECK((order == std::vector<int>{0, -3, -6, -9}));
+
+    EventReplayer<void(int)> otherArguments;
+    CHECK(!otherArguments.Open(path));
+    std::remove(path.c_str());
+}
+
+void TestPaced() {
+    using namespace std::chrono_literals;
+    std::string path {RecordingPath("paced")};
+    Event<void(int)> onTick;
+    {
+        EventRecorder<void(int)> recorder;
+        CHECK(recorder.Create(path));
+        recorder.Attach(onTick);
+        onTick.Invoke(0);
+        std::this_thread::sleep_for(40ms);
+        onTick.Invoke(1);
+    }
+
+    EventReplayer<void(int)> replayer;
+    CHECK(replayer.Open(path));
+    CHECK(replayer.Duration() >= 40'000'000);
+    int raised {0};
+    onTick.Subscribe([&](int) { ++raised; });
+    replayer.Target(0, onTick);
+
+    auto start {std::chrono::steady_clock::now()};
+    CHECK(replayer.ReplayPaced(2.0) == 2);
+    CHECK(std::chrono::steady_clock::now() - start >= 20ms);
+    CHECK(raised == 2);
+
+    // Without a positive speed there is nothing to wait for
+    start = std::chrono::steady_clock::now();
+    CHECK(replayer.ReplayPaced(0.0) == 2);
+    CHECK(replayer.ReplayPaced(-1.0) == 2);
+    CHECK(std::chrono::steady_clock::now() - start < 40ms);
+    CHECK(raised == 6);
+    std::remove(path.c_str());
+}
+
+int main() {
+    TestReplay();
+    TestPaced();
+
+    std::printf("recording: all checks passed\n");
+}
@@ -0,0 +1,120 @@
+// Test program: handlers subscribing, unsubscribing and raising the same event while it is being raised.
+// Random mutations are checked against a model of the subscribers. Build with -fsanitize=address to also
+// catch a handler being destroyed while it runs.
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../Event.hpp"
+#include "Check.hpp"
+
+struct Subscriber {
+    SubscriptionHandle handle;
+    int priority;
+    bool alive;
+    bool addedDuringDispatch;
+};
+
+Event<void(int)> event;
+std::vector<Subscriber> subscribers; // Indexed by the number each handler was created with
+std::vector<int> calls;
+std::mt19937 rng {12345};
+int depth {0};
+bool quiet {false}; // Handlers don't mutate the event
+
+void Subscribe(int priority);
+
+//* Called by every handler: checks it should be running, then mutates the event at random
+void OnEvent(int self, const std::string& payload) {
+    CHECK(subscribers[self].alive);
+    CHECK(!subscribers[self].addedDuringDispatch);
+    CHECK(payload == "payload long enough to live on the heap " + std::to_string(self));
+    calls.push_back(self);
+    if (quiet) {
+        return;
+    }
+
+    switch (rng() % 8) {
+    case 0:
+        Subscribe(static_cast<int>(rng() % 5) - 2);
+        break;
+    case 1: {
+        // Unsubscribe some subscriber, maybe one already called or one still to come in this Invoke
+        int target {static_cast<int>(rng() % subscribers.size())};
+        event.Unsubscribe(subscribers[target].handle);
+        subscribers[target].alive = false;
+        break;
+    }
+    case 2:
+        // One-shot handler removing itself
+        event.Unsubscribe(subscribers[self].handle);
+        subscribers[self].alive = false;
+        break;
+    case 3:
+        if (depth < 3) {
+            ++depth;
+            event.Invoke(self);
+            --depth;
+        }
+        break;
+    case 4:
+        if (rng() % 16 == 0) {
+            event.RemoveFreeFunctions();
+            for (auto& subscriber : subscribers) {
+                subscriber.alive = false;
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void Subscribe(int priority) {
+    int self {static_cast<int>(subscribers.size())};
+    std::string payload {"payload long enough to live on the heap " + std::to_string(self)};
+    SubscriptionHandle handle {event.Subscribe([self, payload](int) { OnEvent(self, payload); }, priority)};
+    subscribers.push_back({handle, priority, true, depth > 0});
+}
+
+//* Raises the event without mutations and checks every live subscriber is called once, in priority order
+void CheckOrder() {
+    std::vector<int> expected;
+    for (int i = 0; i < static_cast<int>(subscribers.size()); ++i) {
+        if (subscribers[i].alive) {
+            expected.push_back(i);
+            CHECK(event.IsSubscribed(subscribers[i].handle));
+        } else {
+            CHECK(!event.IsSubscribed(subscribers[i].handle));
+        }
+    }
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](int lhs, int rhs) { return subscribers[lhs].priority > subscribers[rhs].priority; });
+
+    quiet = true;
+    calls.clear();
+    event.Invoke(0);
+    quiet = false;
+    CHECK(calls == expected);
+}
+
+int main() {
+    for (int round = 0; round < 2000; ++round) {
+        if (subscribers.size() < 8 || rng() % 4 == 0) {
+            Subscribe(static_cast<int>(rng() % 5) - 2);
+        }
+        calls.clear();
+        event.Invoke(round);
+        for (auto& subscriber : subscribers) {
+            subscriber.addedDuringDispatch = false;
+        }
+        if (round % 50 == 0) {
+            CheckOrder();
+        }
+    }
+
+    std::printf("reentrancy: %zu subscribers created, all checks passed\n", subscribers.size());
+}
@@ -0,0 +1,161 @@
+// Test program: SharedEventPublisher and SharedEventMirror. Checks that raises of a local event reach a mirror in the
+// same process and in a child process in order, that local subscribers keep working, that a mirror of other
+// arguments can't open the channel, that a mirror falling behind counts the overwritten raises, and that recreating
+// the channel with another capacity leaves the mapped mirrors on the old one.
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "../SharedEventChannel.hpp"
+#include "Check.hpp"
+
+struct Position {
+    float x;
+    float y;
+};
+
+//* Unique per run, so that parallel test runs don't share a channel
+std::string ChannelName(const char* suffix) {
+    return "/event_system_test_" + std::to_string(getpid()) + "_" + suffix;
+}
+
+void TestSameProcess() {
+    std::string name {ChannelName("local")};
+    Event<void(int, Position)> onMove;
+    std::vector<int> local;
+    onMove.Subscribe([&](int id, Position) { local.push_back(id); });
+
+    SharedEventPublisher<void(int, Position)> publisher;
+    CHECK(publisher.Create(name, 5));
+    CHECK(publisher.Capacity() == 8);
+    publisher.Attach(onMove);
+
+    SharedEventMirror<void(int, Position)> mirror;
+    CHECK(mirror.Open(name));
+    CHECK(!mirror.Closed());
+    std::vector<int> mirrored;
+    float sum {0};
+    mirror.Subscribe([&](int id, Position position) {
+        mirrored.push_back(id);
+        sum += position.x + position.y;
+    });
+
+    SharedEventMirror<void(int)> otherArguments;
+    CHECK(!otherArguments.Open(name));
+
+    onMove.Invoke(1, Position{1, 2});
+    onMove.Invoke(2, Position{3, 4});
+    CHECK((local == std::vector<int>{1, 2}));
+    CHECK(mirrored.empty());
+    CHECK(mirror.Poll() == 2);
+    CHECK((mirrored == std::vector<int>{1, 2}));
+    CHECK(sum == 10);
+    CHECK(mirror.Poll() == 0);
+
+    // Falling a whole ring behind drops the oldest raises
+    for (int i = 0; i < 12; ++i) {
+        onMove.Invoke(10 + i, Position{0, 0});
+    }
+    mirrored.clear();
+    CHECK(mirror.Poll() == 8);
+    CHECK(mirror.Missed() == 4);
+    CHECK(mirrored.front() == 14 && mirrored.back() == 21);
+
+    // Mirrors are events too, local code can raise them
+    mirror.Invoke(99, Position{0, 0});
+    CHECK(mirrored.back() == 99);
+
+    SharedEventRing<int, Position>::Remove(name);
+}
+
+void TestTwoProcesses() {
+    constexpr int Raises {100000};
+    std::string name {ChannelName("fork")};
+    Event<void(int, double)> onTick;
+    SharedEventPublisher<void(int, double)> publisher;
+    CHECK(publisher.Create(name, 1u << 17));
+    publisher.Attach(onTick);
+
+    // Pipes only to start the publisher once the child mirror is open, and to read its result
+    int ready[2];
+    int result[2];
+    CHECK(pipe(ready) == 0 && pipe(result) == 0);
+    pid_t child {fork()};
+    CHECK(child >= 0);
+    if (child == 0) {
+        SharedEventMirror<void(int, double)> mirror;
+        int failures {mirror.Open(name) ? 0 : 1};
+        int next {0};
+        mirror.Subscribe([&](int sequence, double value) {
+            failures += sequence != next || value != sequence * 0.5;
+            next = sequence + 1;
+        });
+        char byte {1};
+        (void)!write(ready[1], &byte, 1);
+        while (failures == 0 && next < Raises && !(mirror.Closed() && mirror.Poll() == 0)) {
+            if (mirror.Poll() == 0) {
+                std::this_thread::yield();
+            }
+        }
+        failures += next != Raises || mirror.Missed() != 0;
+        (void)!write(result[1], &failures, sizeof(failures));
+        _exit(0);
+    }
+
+    char byte {0};
+    CHECK(read(ready[0], &byte, 1) == 1);
+    for (int i = 0; i < Raises; ++i) {
+        onTick.Invoke(i, i * 0.5);
+    }
+    int failures {-1};
+    CHECK(read(result[0], &failures, sizeof(failures)) == sizeof(failures));
+    int status {0};
+    waitpid(child, &status, 0);
+    CHECK(WIFEXITED(status) && failures == 0);
+
+    SharedEventRing<int, double>::Remove(name);
+}
+
+void TestRecreate() {
+    std::string name {ChannelName("recreate")};
+    Event<void(int)> onValue;
+    SharedEventPublisher<void(int)> publisher;
+    CHECK(publisher.Create(name, 4096));
+    publisher.Attach(onValue);
+    SharedEventMirror<void(int)> mirror;
+    CHECK(mirror.Open(name));
+    std::vector<int> values;
+    mirror.Subscribe([&](int value) { values.push_back(value); });
+
+    // Same signature and capacity: the mirror keeps receiving
+    onValue.Invoke(1);
+    CHECK(publisher.Create(name, 4096));
+    onValue.Invoke(2);
+    CHECK(mirror.Poll() == 2 && !mirror.Closed());
+    CHECK((values == std::vector<int>{1, 2}));
+
+    // Another capacity: a new channel, the old mapping stays valid and is closed
+    CHECK(publisher.Create(name, 2));
+    CHECK(mirror.Closed());
+    onValue.Invoke(3);
+    CHECK(mirror.Poll() == 0);
+    SharedEventMirror<void(int)> reopened;
+    CHECK(reopened.Open(name) && reopened.Capacity() == 2);
+    onValue.Invoke(4);
+    CHECK(reopened.Poll() == 1);
+
+    SharedEventRing<int>::Remove(name);
+}
+
+int main() {
+    TestSameProcess();
+    TestRecreate();
+    TestTwoProcesses();
+
+    std::printf("shared_channel: all checks passed\n");
+}
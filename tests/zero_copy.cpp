@@ -0,0 +1,236 @@
+// Test program: counts the copies and moves of the arguments of Invoke, InvokeMoveLast and the other ways to raise
+// an event, and checks that no subscriber gets an argument another one moved away.
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "../CompactEvent.hpp"
+#include "../ConcurrentEvent.hpp"
+#include "../Event.hpp"
+#include "../QueuedEvent.hpp"
+#include "Check.hpp"
+
+//* Payload counting how many times it was copied and moved. A moved-from payload has no hits.
+struct Hits {
+    static inline int copies {0};
+    static inline int moves {0};
+
+    std::vector<int> hits;
+
+    Hits() : hits(3, 1) {}
+    Hits(const Hits& other) : hits{other.hits} { ++copies; }
+    Hits(Hits&& other) noexcept : hits{std::move(other.hits)} { ++moves; }
+    Hits& operator=(const Hits& other) { hits = other.hits; ++copies; return *this; }
+    Hits& operator=(Hits&& other) noexcept { hits = std::move(other.hits); ++moves; return *this; }
+
+    static void Reset() {
+        copies = 0;
+        moves = 0;
+    }
+};
+
+int received {0}; // Full payloads seen by the handlers
+
+void Check(const Hits& payload) {
+    CHECK(payload.hits.size() == 3);
+    ++received;
+}
+
+struct Listener {
+    std::vector<Hits> kept;
+
+    void OnValue(Hits payload) {
+        Check(payload);
+    }
+
+    void OnValueConst(Hits payload) const {
+        Check(payload);
+    }
+
+    void Keep(Hits payload) {
+        Check(payload);
+        kept.push_back(std::move(payload));
+    }
+
+    void OnRvalue(Hits&& payload) {
+        Check(payload);
+        Hits stolen {std::move(payload)};
+    }
+
+    int Count(Hits payload) {
+        Check(payload);
+        return static_cast<int>(payload.hits.size());
+    }
+};
+
+void ExpectCounts(int copies, int moves, int calls) {
+    CHECK(Hits::copies == copies);
+    CHECK(Hits::moves == moves);
+    CHECK(received == calls);
+    Hits::Reset();
+    received = 0;
+}
+
+void TestByValue() {
+    Listener listener;
+    Event<void(Hits)> event;
+    event.Subscribe([](const Hits& payload) { Check(payload); });
+    event.Subscribe(&Listener::OnValue, &listener);
+    event.Subscribe<&Listener::OnValue>(&listener);
+    event.Subscribe(&Listener::OnValueConst, static_cast<const Listener*>(&listener));
+    event.Subscribe([](Hits payload) { Check(payload); Hits stolen {std::move(payload)}; });
+    event.Subscribe([](const Hits& payload) { Check(payload); });
+
+    // Raising copies nothing, subscribers taking the payload by value get one copy each and nothing else
+    Hits payload;
+    Hits::Reset();
+    event.Invoke(payload);
+    ExpectCounts(4, 1, 6);
+    event.Invoke(Hits{});
+    ExpectCounts(4, 1, 6);
+    event(payload);
+    ExpectCounts(4, 1, 6);
+
+    // The last subscriber takes the payload, moved into InvokeMoveLast
+    event.InvokeMoveLast(std::move(payload));
+    ExpectCounts(4, 2, 6);
+}
+
+void TestMoveLast() {
+    Listener listener;
+    listener.kept.reserve(2);
+    Event<void(Hits)> event;
+    event.Subscribe([](const Hits& payload) { Check(payload); }, 1);
+    event.Subscribe(&Listener::Keep, &listener);
+
+    // Moved into Keep's parameter, then into kept
+    Hits::Reset();
+    event.InvokeMoveLast(Hits{});
+    ExpectCounts(0, 2, 2);
+    CHECK(listener.kept.size() == 1);
+
+    // Copied into InvokeMoveLast first
+    Hits payload;
+    Hits::Reset();
+    event.InvokeMoveLast(payload);
+    ExpectCounts(1, 2, 2);
+    CHECK(listener.kept.size() == 2 && listener.kept.back().hits.size() == 3);
+    CHECK(payload.hits.size() == 3);
+
+    // With the last subscriber gone the remaining one takes the payload, as a const reference
+    event.RemoveListener(&listener);
+    Hits::Reset();
+    event.InvokeMoveLast(Hits{});
+    ExpectCounts(0, 0, 1);
+}
+
+void TestRvalueReference() {
+    Listener listener;
+    Event<void(Hits&&)> event;
+    event.Subscribe(&Listener::OnRvalue, &listener);
+    event.Subscribe([](const Hits& payload) { Check(payload); });
+    event.Subscribe(&Listener::OnRvalue, &listener);
+
+    // Each subscriber taking an rvalue gets its own copy, so none of them sees the payload moved away
+    Hits::Reset();
+    event.Invoke(Hits{});
+    ExpectCounts(2, 2, 3);
+
+    Hits payload;
+    Hits::Reset();
+    event.InvokeMoveLast(std::move(payload));
+    ExpectCounts(1, 2, 3); // The last one takes the payload itself
+    CHECK(payload.hits.empty());
+}
+
+void TestLvalueReference() {
+    Event<void(Hits&)> event;
+    event.Subscribe([](Hits& payload) { Check(payload); payload.hits.push_back(4); });
+    event.Subscribe([](Hits& payload) { CHECK(payload.hits.size() == 4); payload.hits.pop_back(); });
+
+    Hits payload;
+    Hits::Reset();
+    event.Invoke(payload);
+    event.InvokeMoveLast(payload);
+    ExpectCounts(0, 0, 2);
+    CHECK(payload.hits.size() == 3);
+}
+
+void TestOtherInvokes() {
+    Listener listener;
+    const auto view {[](const Hits& payload) { Check(payload); }};
+    Hits payload;
+
+    Event<int(Hits)> counted;
+    counted.Subscribe(&Listener::Count, &listener);
+    counted.Subscribe([](const Hits& payload) { Check(payload); return 1; });
+    Hits::Reset();
+    CHECK(counted.Invoke(CombineSum<int>{}, payload) == 4);
+    CHECK(counted.Invoke<CombineSum<int>>(payload) == 4);
+    ExpectCounts(2, 0, 4);
+
+    Event<void(Hits)> keyed;
+    keyed.Subscribe(EventKey{7}, view);
+    keyed.Subscribe(EventKey{7}, &Listener::OnValue, &listener);
+    Hits::Reset();
+    keyed.Invoke(EventKey{7}, payload);
+    ExpectCounts(1, 0, 2);
+
+    CompactEvent<void(Hits)> compact;
+    compact.Subscribe(view);
+    compact.Subscribe(&Listener::OnValue, &listener);
+    Hits::Reset();
+    compact.Invoke(payload);
+    compact.InvokeMoveLast(Hits{}); // Moved from the CompactEvent to its Event, then to the last subscriber
+    ExpectCounts(1, 2, 4);
+
+    ConcurrentEvent<void(Hits)> concurrent;
+    concurrent.Subscribe(view);
+    concurrent.Subscribe(&Listener::OnValue, &listener);
+    Hits::Reset();
+    concurrent.Invoke(payload);
+    concurrent.InvokeMoveLast(Hits{});
+    ExpectCounts(1, 1, 4);
+
+    QueuedEvent<void(Hits)> queued;
+    queued.Subscribe(view);
+    queued.Subscribe(view);
+    queued.Enqueue(payload);
+    queued.Enqueue(Hits{});
+    Hits::Reset();
+    queued.Flush();
+    ExpectCounts(0, 0, 4);
+
+    // Called directly, a delegate hands its own arguments to the function
+    Delegate<void(Hits)> func {&Listener::Keep, &listener};
+    Hits::Reset();
+    func(Hits{});
+    ExpectCounts(0, 2, 1);
+}
+
+void TestMoveOnly() {
+    int total {0};
+    Event<void(std::unique_ptr<int>)> event;
+    event.Subscribe([&](std::unique_ptr<int> value) { total += *value; });
+    event.Invoke(std::make_unique<int>(1));
+    event.InvokeMoveLast(std::make_unique<int>(2));
+    CHECK(total == 3);
+
+    Event<void(const std::unique_ptr<int>&)> shared;
+    shared.Subscribe([&](const std::unique_ptr<int>& value) { total += *value; });
+    shared.Subscribe([&](const std::unique_ptr<int>& value) { total += *value; });
+    shared.Invoke(std::make_unique<int>(1));
+    CHECK(total == 5);
+}
+
+int main() {
+    TestByValue();
+    TestMoveLast();
+    TestRvalueReference();
+    TestLvalueReference();
+    TestOtherInvokes();
+    TestMoveOnly();
+
+    std::printf("zero_copy: all checks passed\n");
+}